@@ -0,0 +1,194 @@
+#include "assignment.h"
+#include "stats.h"
+#include "smallassignment.h"
+
+// Потенциалы u (строки) и v (столбцы) поддерживают неотрицательность приведённых
+// стоимостей; каждая фаза добавляет одну строку по кратчайшему увеличивающему пути
+double runHungarian(const double* cost, int n, AlgorithmWorkspace& workspace,
+                    const SolveOptions& options, SolveStatus& status) {
+    const double INF = 1e9;
+    GRAPH_STAT_TIMER(assignmentSolveSeconds);
+    status = SolveStatus();
+    status.phasesTotal = n;
+
+    std::vector<double>& u = workspace.doubles(AlgorithmWorkspace::PotentialU, n + 1, 0.0);
+    std::vector<double>& v = workspace.doubles(AlgorithmWorkspace::PotentialV, n + 1, 0.0);
+    std::vector<int>& p = workspace.ints(AlgorithmWorkspace::Assignment, n + 1, 0);
+    std::vector<int>& way = workspace.ints(AlgorithmWorkspace::Way, n + 1, 0);
+
+    for (int i = 1; i <= n; i++) {
+        if (options.shouldStop()) {
+            status.complete = false;
+            break;
+        }
+
+        p[0] = i;
+        int j0 = 0;
+        std::vector<double>& minv = workspace.doubles(AlgorithmWorkspace::MinDelta, n + 1, INF);
+        std::vector<int>& used = workspace.ints(AlgorithmWorkspace::Used, n + 1, 0);
+
+        do {
+            used[j0] = 1;
+            int i0 = p[j0];
+            double delta = INF;
+            int j1 = 0;
+            const double* row = &cost[static_cast<std::size_t>(i0 - 1) * n];
+
+            for (int j = 1; j <= n; j++) {
+                if (!used[j]) {
+                    double cur = row[j-1] - u[i0] - v[j];
+                    if (cur < minv[j]) {
+                        minv[j] = cur;
+                        way[j] = j0;
+                    }
+                    if (minv[j] < delta) {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+            }
+
+            GRAPH_STAT_ADD(dualUpdates, 1);
+            for (int j = 0; j <= n; j++) {
+                if (used[j]) {
+                    u[p[j]] += delta;
+                    v[j] -= delta;
+                } else {
+                    minv[j] -= delta;
+                }
+            }
+
+            j0 = j1;
+        } while (p[j0] != 0);
+
+        GRAPH_STAT_ADD(augmentingPaths, 1);
+        do {
+            int j1 = way[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while (j0);
+
+        status.phasesDone = i;
+        if (options.progress) {
+            options.progress(i, n);
+        }
+    }
+
+    if (!status.complete) {
+        double partialCost = 0.0;
+        for (int j = 1; j <= n; j++) {
+            if (p[j] != 0) {
+                partialCost += cost[static_cast<std::size_t>(p[j] - 1) * n + (j - 1)];
+            }
+        }
+        return partialCost;
+    }
+    return -v[0];
+}
+
+bool integerCostsFit(std::int64_t maxAbsCost, int n) {
+    return maxAbsCost >= 0 && maxAbsCost <= std::numeric_limits<std::int64_t>::max() / (4 * (static_cast<std::int64_t>(n) + 1));
+}
+
+bool runHungarianInteger(const std::int64_t* cost, int n, AlgorithmWorkspace& workspace,
+                         const SolveOptions& options, SolveStatus& status, std::int64_t& total) {
+    const std::int64_t INF = std::numeric_limits<std::int64_t>::max();
+    GRAPH_STAT_TIMER(assignmentSolveSeconds);
+    status = SolveStatus();
+    status.phasesTotal = n;
+    total = 0;
+
+    std::vector<std::int64_t>& u = workspace.longs(AlgorithmWorkspace::IntegerPotentialU, n + 1, 0);
+    std::vector<std::int64_t>& v = workspace.longs(AlgorithmWorkspace::IntegerPotentialV, n + 1, 0);
+    std::vector<int>& p = workspace.ints(AlgorithmWorkspace::Assignment, n + 1, 0);
+    std::vector<int>& way = workspace.ints(AlgorithmWorkspace::Way, n + 1, 0);
+
+    for (int i = 1; i <= n; i++) {
+        if (options.shouldStop()) {
+            status.complete = false;
+            break;
+        }
+
+        p[0] = i;
+        int j0 = 0;
+        std::vector<std::int64_t>& minv = workspace.longs(AlgorithmWorkspace::IntegerMinDelta, n + 1, INF);
+        std::vector<int>& used = workspace.ints(AlgorithmWorkspace::Used, n + 1, 0);
+
+        do {
+            used[j0] = 1;
+            int i0 = p[j0];
+            std::int64_t delta = INF;
+            int j1 = 0;
+            const std::int64_t* row = &cost[static_cast<std::size_t>(i0 - 1) * n];
+
+            for (int j = 1; j <= n; j++) {
+                if (!used[j]) {
+                    if (row[j-1] != kNoPair) {
+                        std::int64_t cur = row[j-1] - u[i0] - v[j];
+                        if (cur < minv[j]) {
+                            minv[j] = cur;
+                            way[j] = j0;
+                        }
+                    }
+                    if (minv[j] < delta) {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+            }
+
+            // Ни один столбец вне дерева не достижим: условие Холла нарушено
+            if (j1 == 0) {
+                return false;
+            }
+
+            GRAPH_STAT_ADD(dualUpdates, 1);
+            for (int j = 0; j <= n; j++) {
+                if (used[j]) {
+                    u[p[j]] += delta;
+                    v[j] -= delta;
+                } else if (minv[j] != INF) {
+                    minv[j] -= delta;
+                }
+            }
+
+            j0 = j1;
+        } while (p[j0] != 0);
+
+        GRAPH_STAT_ADD(augmentingPaths, 1);
+        do {
+            int j1 = way[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while (j0);
+
+        status.phasesDone = i;
+        if (options.progress) {
+            options.progress(i, n);
+        }
+    }
+
+    for (int j = 1; j <= n; j++) {
+        if (p[j] != 0) {
+            total += cost[static_cast<std::size_t>(p[j] - 1) * n + (j - 1)];
+        }
+    }
+    return true;
+}
+
+double solveAssignmentMatrix(const double* cost, int n, int* assignment, AlgorithmWorkspace& workspace) {
+    double smallCost;
+    if (solveSmallAssignment(n, cost, assignment, smallCost)) {
+        return smallCost;
+    }
+
+    static const SolveOptions defaultOptions;
+    SolveStatus status;
+    double totalCost = runHungarian(cost, n, workspace, defaultOptions, status);
+
+    const std::vector<int>& p = workspace.ints(AlgorithmWorkspace::Assignment);
+    for (int j = 1; j <= n; j++) {
+        assignment[p[j] - 1] = j - 1;
+    }
+    return totalCost;
+}
@@ -0,0 +1,39 @@
+#ifndef ASSIGNMENT_H
+#define ASSIGNMENT_H
+
+#include "workspace.h"
+#include "solveoptions.h"
+#include <cstdint>
+#include <limits>
+
+// Ядро венгерского алгоритма над плотной матрицей стоимостей n x n (cost[i * n + j])
+// Стоимость INF (1e9) означает отсутствие пары. После вызова в буфере
+// workspace.ints(AlgorithmWorkspace::Assignment) для столбца j (с 1) лежит строка (с 1)
+// или 0; возвращается стоимость оптимального назначения добавленных строк
+double runHungarian(const double* cost, int n, AlgorithmWorkspace& workspace,
+                    const SolveOptions& options, SolveStatus& status);
+
+// Отсутствующая пара в целочисленной матрице стоимостей
+constexpr std::int64_t kNoPair = std::numeric_limits<std::int64_t>::max();
+
+// Задачи от этого размера, в которых пар не больше n * n / kSparseAssignmentDensity,
+// solveAssignmentProblem решает сетевым симплекс-методом (mincostflow.h) без матрицы n x n
+constexpr int kSparseAssignmentMinSize = 256;
+constexpr int kSparseAssignmentDensity = 4;
+
+// Помещаются ли стоимости с модулем до maxAbsCost в целочисленный режим для размера n:
+// потенциалы и приведённые стоимости не выходят за 4 (n + 1) maxAbsCost
+bool integerCostsFit(std::int64_t maxAbsCost, int n);
+
+// Целочисленный венгерский алгоритм: вся арифметика точная, пары kNoPair не рассматриваются.
+// Если из дерева поиска не достижим ни один свободный столбец, совершенного назначения
+// нет, и функция возвращает false. Иначе в total - стоимость, а в буфере
+// workspace.ints(AlgorithmWorkspace::Assignment) - строка (с 1) для каждого столбца (с 1)
+bool runHungarianInteger(const std::int64_t* cost, int n, AlgorithmWorkspace& workspace,
+                         const SolveOptions& options, SolveStatus& status, std::int64_t& total);
+
+// Задача о назначениях для плотной матрицы конечных стоимостей
+// В assignment[i] записывается столбец строки i, возвращается минимальная стоимость
+double solveAssignmentMatrix(const double* cost, int n, int* assignment, AlgorithmWorkspace& workspace);
+
+#endif // ASSIGNMENT_H
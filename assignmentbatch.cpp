@@ -0,0 +1,52 @@
+#include "assignmentbatch.h"
+#include "assignment.h"
+#include "parallel.h"
+
+namespace {
+
+// Число задач в блоке: поток берёт из общего счётчика сразу несколько задач
+const std::size_t kBatchChunk = 16;
+
+}
+
+AssignmentBatchSolver::AssignmentBatchSolver(int threads) : threads(threads), workspaces() {}
+
+template <typename SolveItem>
+void AssignmentBatchSolver::run(std::size_t count, SolveItem solveItem) {
+    std::size_t chunks = (count + kBatchChunk - 1) / kBatchChunk;
+    std::size_t workers = chunkWorkers(chunks, threads);
+    if (workspaces.size() < workers) {
+        workspaces.resize(workers);
+    }
+
+    forEachChunkIndexed(chunks, threads, [&](std::size_t chunk, int worker) {
+        std::size_t end = std::min(count, (chunk + 1) * kBatchChunk);
+        for (std::size_t k = chunk * kBatchChunk; k < end; k++) {
+            solveItem(k, workspaces[worker]);
+        }
+    });
+}
+
+void AssignmentBatchSolver::solve(const double* costs, int n, std::size_t count,
+                                  double* totalCosts, int* assignments) {
+    std::size_t matrixSize = static_cast<std::size_t>(n) * n;
+    run(count, [&](std::size_t k, AlgorithmWorkspace& workspace) {
+        totalCosts[k] = solveAssignmentMatrix(costs + k * matrixSize, n, assignments + k * n, workspace);
+    });
+}
+
+void AssignmentBatchSolver::solve(const double* costs, const int* sizes, std::size_t count,
+                                  double* totalCosts, int* assignments) {
+    // Смещения задач в упакованных массивах
+    std::vector<std::size_t> costOffsets(count + 1, 0);
+    std::vector<std::size_t> assignmentOffsets(count + 1, 0);
+    for (std::size_t k = 0; k < count; k++) {
+        costOffsets[k + 1] = costOffsets[k] + static_cast<std::size_t>(sizes[k]) * sizes[k];
+        assignmentOffsets[k + 1] = assignmentOffsets[k] + sizes[k];
+    }
+
+    run(count, [&](std::size_t k, AlgorithmWorkspace& workspace) {
+        totalCosts[k] = solveAssignmentMatrix(costs + costOffsets[k], sizes[k],
+                                              assignments + assignmentOffsets[k], workspace);
+    });
+}
@@ -0,0 +1,31 @@
+#ifndef ASSIGNMENTBATCH_H
+#define ASSIGNMENTBATCH_H
+
+#include "workspace.h"
+#include <cstddef>
+#include <vector>
+
+// Решение пакета независимых задач о назначениях без построения графов
+// Матрицы стоимостей лежат подряд в одном массиве (каждая построчно), результаты -
+// в плоских массивах: стоимость каждой задачи и столбец для каждой строки.
+// Задачи распределяются по потокам; рабочие области потоков сохраняются между вызовами
+class AssignmentBatchSolver {
+private:
+    int threads;
+    std::vector<AlgorithmWorkspace> workspaces;
+
+    template <typename SolveItem>
+    void run(std::size_t count, SolveItem solveItem);
+
+public:
+    explicit AssignmentBatchSolver(int threads = 0);
+
+    // count задач одного размера n: матрица k начинается с costs[k * n * n],
+    // её назначение - с assignments[k * n]
+    void solve(const double* costs, int n, std::size_t count, double* totalCosts, int* assignments);
+
+    // count задач размеров sizes[k]: матрицы и назначения идут подряд без промежутков
+    void solve(const double* costs, const int* sizes, std::size_t count, double* totalCosts, int* assignments);
+};
+
+#endif // ASSIGNMENTBATCH_H
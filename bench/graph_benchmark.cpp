@@ -0,0 +1,593 @@
+// Замеры производительности алгоритмов графа (Google Benchmark)
+//
+// Сборка из корня репозитория:
+//   g++ -std=c++17 -O2 -I. bench/graph_benchmark.cpp graph.cpp vertex.cpp edge.cpp
+//       labelarena.cpp workspace.cpp status.cpp logsink.cpp parsing.cpp generators.cpp
+//       stats.cpp solveoptions.cpp bipartitetracker.cpp matchingtracker.cpp assignment.cpp
+//       assignmentbatch.cpp bottleneck.cpp murty.cpp capacitated.cpp mincostflow.cpp
+//       parallelmatching.cpp reordering.cpp bitmatching.cpp -lbenchmark -lpthread -o graph_benchmark
+// С -DGRAPH_STATS к результатам добавляются счётчики алгоритмов на одну итерацию
+// Промахи кэша для замеров перенумерации: --benchmark_perf_counters=CACHE-MISSES
+// (Google Benchmark, собранный с libpfm) или perf stat -e cache-misses с --benchmark_filter
+//
+// Дополнительные параметры (остальные передаются Google Benchmark):
+//   --sizes=1024,8192        число вершин в графах
+//   --degree=4               средняя степень вершины
+//   --assignment_sizes=64,256 размеры задачи о назначениях
+//   --dense_sizes=512,2048   первая доля плотных двудольных графов (плотность 20%)
+//   --threads=1,4            число потоков параллельного паросочетания
+//   --seed=1                 зерно генератора
+#include "graph.h"
+#include "generators.h"
+#include "assignmentbatch.h"
+#include "logsink.h"
+#include "stats.h"
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+enum class Family {
+    RandomBipartite,
+    RandomGeneral,
+    Grid,
+    PowerLaw,
+    Adversarial
+};
+
+const char* familyName(Family family) {
+    switch (family) {
+        case Family::RandomBipartite: return "random_bipartite";
+        case Family::RandomGeneral: return "random_general";
+        case Family::Grid: return "grid";
+        case Family::PowerLaw: return "power_law";
+        case Family::Adversarial: return "adversarial";
+    }
+    return "unknown";
+}
+
+bool isBipartiteFamily(Family family) {
+    return family == Family::RandomBipartite || family == Family::Grid || family == Family::Adversarial;
+}
+
+struct Settings {
+    std::vector<int> sizes = {1024, 8192};
+    std::vector<int> assignmentSizes = {64, 256};
+    std::vector<int> denseSizes = {512, 2048};
+    std::vector<int> threads = {1, 4};
+    int degree = 4;
+    unsigned seed = 1;
+};
+
+Settings settings;
+
+long peakRssKilobytes() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+void addVertices(Graph& graph, int count) {
+    for (int i = 0; i < count; i++) {
+        graph.tryAddVertex(i, "v", 1.0);
+    }
+}
+
+GeneratorOptions generatorOptions(int n) {
+    GeneratorOptions options;
+    options.seed = settings.seed + n;
+    return options;
+}
+
+// Случайный двудольный граф G(n/2, n/2, p) со средней степенью degree
+void buildRandomBipartite(Graph& graph, int n, int degree) {
+    int half = n / 2;
+    double p = half > 0 ? std::min(1.0, static_cast<double>(degree) / half) : 0.0;
+    loadIntoGraph(graph, generateBipartite(half, half, p, generatorOptions(n)), false);
+}
+
+// Случайный граф Эрдёша-Реньи G(n, m)
+void buildRandomGeneral(Graph& graph, int n, int degree) {
+    std::size_t edges = static_cast<std::size_t>(n) * degree / 2;
+    loadIntoGraph(graph, generateErdosRenyi(n, edges, generatorOptions(n)), false);
+}
+
+// Квадратная решётка со стороной sqrt(n)
+void buildGrid(Graph& graph, int n) {
+    int side = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(n))));
+    addVertices(graph, side * side);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int v = r * side + c;
+            if (c + 1 < side) graph.tryAddEdge(v, v + 1, 1.0, false);
+            if (r + 1 < side) graph.tryAddEdge(v, v + side, 1.0, false);
+        }
+    }
+}
+
+// Степенное распределение степеней (R-MAT с параметрами Graph500)
+void buildPowerLaw(Graph& graph, int n, int degree) {
+    int scale = 1;
+    while ((1 << scale) < n) {
+        scale++;
+    }
+    std::size_t edges = static_cast<std::size_t>(n) * degree / 2;
+    loadIntoGraph(graph, generateRmat(scale, edges, 0.57, 0.19, 0.19, generatorOptions(n)), false);
+}
+
+// Цепочка, в которой жадный выбор ошибается на каждом шаге:
+// левая вершина i сначала видит правую i+1, и последний поиск
+// проходит увеличивающий путь через весь граф
+void buildAdversarial(Graph& graph, int n) {
+    int half = n / 2;
+    addVertices(graph, 2 * half);
+    for (int i = 0; i < half; i++) {
+        if (i + 1 < half) {
+            graph.tryAddEdge(i, half + i + 1, 1.0, false);
+        }
+        graph.tryAddEdge(i, half + i, 1.0, false);
+    }
+}
+
+// Графы строятся один раз на семейство и размер и переиспользуются всеми замерами
+const Graph& cachedGraph(Family family, int n) {
+    static std::map<std::pair<int, int>, std::unique_ptr<Graph>> cache;
+    auto key = std::make_pair(static_cast<int>(family), n);
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        return *it->second;
+    }
+
+    auto graph = std::make_unique<Graph>();
+    switch (family) {
+        case Family::RandomBipartite: buildRandomBipartite(*graph, n, settings.degree); break;
+        case Family::RandomGeneral: buildRandomGeneral(*graph, n, settings.degree); break;
+        case Family::Grid: buildGrid(*graph, n); break;
+        case Family::PowerLaw: buildPowerLaw(*graph, n, settings.degree); break;
+        case Family::Adversarial: buildAdversarial(*graph, n); break;
+    }
+    return *cache.emplace(key, std::move(graph)).first->second;
+}
+
+void reportCounters(benchmark::State& state, const Graph& graph) {
+    state.counters["vertices"] = graph.getVertexCount();
+    state.counters["edges"] = graph.getEdgeCount();
+    state.counters["edges/s"] = benchmark::Counter(
+        static_cast<double>(graph.getEdgeCount()) * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["peak_rss_kb"] = peakRssKilobytes();
+
+    if (kStatsEnabled && state.iterations() > 0) {
+        const AlgorithmStats& stats = threadStats();
+        double iterations = static_cast<double>(state.iterations());
+        state.counters["bfs_phases"] = stats.bfsPhases / iterations;
+        state.counters["augmenting_paths"] = stats.augmentingPaths / iterations;
+        state.counters["blossoms"] = stats.blossomsContracted / iterations;
+        state.counters["dual_updates"] = stats.dualUpdates / iterations;
+        state.counters["edges_scanned"] = stats.edgesScanned / iterations;
+        state.counters["allocations"] = stats.allocations / iterations;
+        state.counters["simplex_pivots"] = stats.simplexPivots / iterations;
+    }
+}
+
+void benchIsBipartite(benchmark::State& state, Family family, int n) {
+    Graph graph = cachedGraph(family, n);
+    AlgorithmWorkspace workspace;
+    std::vector<int> partition;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.isBipartite(partition, workspace));
+    }
+    reportCounters(state, graph);
+}
+
+void benchIsBipartiteDFS(benchmark::State& state, Family family, int n) {
+    Graph graph = cachedGraph(family, n);
+    AlgorithmWorkspace workspace;
+    std::vector<int> partition;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.isBipartiteDFS(partition, workspace));
+    }
+    reportCounters(state, graph);
+}
+
+void benchMaximumMatching(benchmark::State& state, Family family, int n) {
+    Graph graph = cachedGraph(family, n);
+    AlgorithmWorkspace workspace;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.findMaximumMatchingDense(workspace).data());
+    }
+    reportCounters(state, graph);
+}
+
+void benchMaximumMatchingBipartite(benchmark::State& state, Family family, int n) {
+    Graph graph = cachedGraph(family, n);
+    AlgorithmWorkspace workspace;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.findMaximumMatchingBipartiteDense(workspace).data());
+    }
+    reportCounters(state, graph);
+}
+
+void benchMaximumMatchingBipartiteParallel(benchmark::State& state, Family family, int n, int threads) {
+    Graph graph = cachedGraph(family, n);
+    AlgorithmWorkspace workspace;
+    ParallelBipartiteMatcher matcher(threads);
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.findMaximumMatchingBipartiteDense(workspace, matcher).data());
+    }
+    reportCounters(state, graph);
+}
+
+// Порядки для замеров перенумерации; -1 - без перенумерации после перемешивания
+const int kOrders[] = {
+    -1, static_cast<int>(VertexOrder::Degree), static_cast<int>(VertexOrder::BreadthFirst),
+    static_cast<int>(VertexOrder::ReverseCuthillMcKee)
+};
+
+const char* orderName(int order) {
+    switch (order) {
+        case static_cast<int>(VertexOrder::Degree): return "degree";
+        case static_cast<int>(VertexOrder::BreadthFirst): return "bfs";
+        case static_cast<int>(VertexOrder::ReverseCuthillMcKee): return "rcm";
+    }
+    return "shuffled";
+}
+
+// Граф семейства со случайно перемешанными индексами вершин (как при загрузке в
+// произвольном порядке), затем перенумерованный порядком order
+Graph reorderedGraph(Family family, int n, int order) {
+    Graph graph = cachedGraph(family, n);
+    std::vector<int> shuffled(graph.getVertexCount());
+    for (int i = 0; i < graph.getVertexCount(); i++) {
+        shuffled[i] = i;
+    }
+    std::mt19937_64 random(settings.seed + n);
+    std::shuffle(shuffled.begin(), shuffled.end(), random);
+    graph.reorderVertices(shuffled);
+    if (order >= 0) {
+        graph.reorderVertices(static_cast<VertexOrder>(order));
+    }
+    return graph;
+}
+
+void benchReorderedIsBipartite(benchmark::State& state, Family family, int n, int order) {
+    Graph graph = reorderedGraph(family, n, order);
+    AlgorithmWorkspace workspace;
+    std::vector<int> partition;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.isBipartite(partition, workspace));
+    }
+    reportCounters(state, graph);
+}
+
+void benchReorderedMatchingBipartite(benchmark::State& state, Family family, int n, int order) {
+    Graph graph = reorderedGraph(family, n, order);
+    AlgorithmWorkspace workspace;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.findMaximumMatchingBipartiteDense(workspace).data());
+    }
+    reportCounters(state, graph);
+}
+
+// Плотный случайный двудольный граф k x k/2 с вероятностью ребра 0.2: половина поисков
+// пути неудачна и обходит всю компоненту. Алгоритм Куна выбирает битовую матрицу;
+// параллельный поиск по спискам смежности - для сравнения
+const Graph& denseBipartiteGraph(int k) {
+    static std::map<int, std::unique_ptr<Graph>> cache;
+    std::unique_ptr<Graph>& graph = cache[k];
+    if (!graph) {
+        graph = std::make_unique<Graph>();
+        loadIntoGraph(*graph, generateBipartite(k, k / 2, 0.2, generatorOptions(k)), false);
+    }
+    return *graph;
+}
+
+void benchDenseMatchingBipartite(benchmark::State& state, int k) {
+    Graph graph = denseBipartiteGraph(k);
+    AlgorithmWorkspace workspace;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.findMaximumMatchingBipartiteDense(workspace).data());
+    }
+    reportCounters(state, graph);
+}
+
+void benchDenseMatchingBipartiteLists(benchmark::State& state, int k) {
+    Graph graph = denseBipartiteGraph(k);
+    AlgorithmWorkspace workspace;
+    ParallelBipartiteMatcher matcher(1);
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.findMaximumMatchingBipartiteDense(workspace, matcher).data());
+    }
+    reportCounters(state, graph);
+}
+
+// Полный двудольный граф k x k со случайными целыми стоимостями от 1 до 1000
+void benchAssignment(benchmark::State& state, int k) {
+    GeneratorOptions options = generatorOptions(k);
+    options.minWeight = 1;
+    options.maxWeight = 1000;
+    options.integerWeights = true;
+    Graph graph;
+    loadCostMatrix(graph, k, generateCostMatrix(k, options));
+    std::vector<int> workers, tasks;
+    for (int i = 0; i < k; i++) {
+        workers.push_back(i);
+        tasks.push_back(k + i);
+    }
+
+    AlgorithmWorkspace workspace;
+    std::vector<std::pair<int, int>> matching;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.solveAssignmentProblem(workers, tasks, matching, workspace));
+    }
+    reportCounters(state, graph);
+}
+
+// 100 лучших назначений полного двудольного графа k x k (алгоритм Мурти)
+void benchKBestAssignments(benchmark::State& state, int k) {
+    GeneratorOptions options = generatorOptions(k);
+    options.minWeight = 1;
+    options.maxWeight = 1000;
+    options.integerWeights = true;
+    Graph graph;
+    loadCostMatrix(graph, k, generateCostMatrix(k, options));
+    std::vector<int> workers, tasks;
+    for (int i = 0; i < k; i++) {
+        workers.push_back(i);
+        tasks.push_back(k + i);
+    }
+
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.findKBestAssignments(workers, tasks, 100));
+    }
+    reportCounters(state, graph);
+}
+
+// Пакет из 1024 независимых задач k x k, решаемых без построения графов
+void benchAssignmentBatch(benchmark::State& state, int k) {
+    const std::size_t count = 1024;
+    GeneratorOptions options = generatorOptions(k);
+    options.minWeight = 1;
+    options.maxWeight = 1000;
+    options.integerWeights = true;
+    std::vector<double> costs;
+    for (std::size_t item = 0; item < count; item++) {
+        options.seed++;
+        std::vector<double> matrix = generateCostMatrix(k, options);
+        costs.insert(costs.end(), matrix.begin(), matrix.end());
+    }
+
+    AssignmentBatchSolver solver;
+    std::vector<double> totalCosts(count);
+    std::vector<int> assignments(count * k);
+    for (auto _ : state) {
+        solver.solve(costs.data(), k, count, totalCosts.data(), assignments.data());
+        benchmark::DoNotOptimize(totalCosts.data());
+    }
+    state.counters["instances/s"] = benchmark::Counter(
+        static_cast<double>(count) * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["peak_rss_kb"] = peakRssKilobytes();
+}
+
+// Двудольный граф n x n с заложенным совершенным паросочетанием, n * degree
+// случайными рёбрами и целыми весами от 1 до 10^6
+void benchBottleneckAssignment(benchmark::State& state, int n) {
+    GeneratorOptions options = generatorOptions(n);
+    options.minWeight = 1;
+    options.maxWeight = 1000000;
+    options.integerWeights = true;
+    EdgeList edges = generatePlantedMatching(n, static_cast<std::size_t>(n) * settings.degree, options);
+    Graph graph;
+    loadIntoGraph(graph, edges, true, false);
+    std::vector<int> workers, tasks;
+    for (int i = 0; i < n; i++) {
+        workers.push_back(i);
+        tasks.push_back(n + i);
+    }
+
+    BottleneckAssignmentSolver solver;
+    std::vector<std::pair<int, int>> matching;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.solveBottleneckAssignment(workers, tasks, matching, solver));
+    }
+    state.counters["probes"] = solver.getProbeCount();
+    reportCounters(state, graph);
+}
+
+// Разреженная задача о назначениях на графе с заложенным паросочетанием
+// (решается сетевым симплекс-методом без матрицы n x n)
+void benchSparseAssignment(benchmark::State& state, int n) {
+    GeneratorOptions options = generatorOptions(n);
+    options.minWeight = 1;
+    options.maxWeight = 1000;
+    options.integerWeights = true;
+    EdgeList edges = generatePlantedMatching(n, static_cast<std::size_t>(n) * settings.degree, options);
+    Graph graph;
+    loadIntoGraph(graph, edges, true, false);
+    std::vector<int> workers, tasks;
+    for (int i = 0; i < n; i++) {
+        workers.push_back(i);
+        tasks.push_back(n + i);
+    }
+
+    AlgorithmWorkspace workspace;
+    std::vector<std::pair<int, int>> matching;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.solveAssignmentProblem(workers, tasks, matching, workspace));
+    }
+    reportCounters(state, graph);
+}
+
+// Назначение с ёмкостями 3 у всех вершин на том же графе с заложенным паросочетанием
+void benchCapacitatedAssignment(benchmark::State& state, int n) {
+    GeneratorOptions options = generatorOptions(n);
+    options.minWeight = 1;
+    options.maxWeight = 1000;
+    options.integerWeights = true;
+    EdgeList edges = generatePlantedMatching(n, static_cast<std::size_t>(n) * settings.degree, options);
+    Graph graph;
+    loadIntoGraph(graph, edges, true, false);
+    std::vector<int> workers, tasks;
+    for (int i = 0; i < n; i++) {
+        workers.push_back(i);
+        tasks.push_back(n + i);
+        graph.vertexAt(i).setWeight(3);
+        graph.vertexAt(n + i).setWeight(3);
+    }
+
+    CapacitatedAssignmentSolver solver;
+    std::vector<std::pair<int, int>> matching;
+    threadStats().reset();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.solveCapacitatedAssignment(workers, tasks, matching, solver));
+    }
+    state.counters["phases"] = solver.getPhaseCount();
+    reportCounters(state, graph);
+}
+
+std::vector<int> parseList(const char* text) {
+    std::vector<int> values;
+    std::string token;
+    for (const char* p = text; ; p++) {
+        if (*p == ',' || *p == '\0') {
+            if (!token.empty()) values.push_back(std::stoi(token));
+            token.clear();
+            if (*p == '\0') break;
+        } else {
+            token += *p;
+        }
+    }
+    return values;
+}
+
+// Разбор собственных параметров; нераспознанные остаются для Google Benchmark
+void parseSettings(int& argc, char** argv) {
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--sizes=", 8) == 0) {
+            settings.sizes = parseList(argv[i] + 8);
+        } else if (std::strncmp(argv[i], "--assignment_sizes=", 19) == 0) {
+            settings.assignmentSizes = parseList(argv[i] + 19);
+        } else if (std::strncmp(argv[i], "--dense_sizes=", 14) == 0) {
+            settings.denseSizes = parseList(argv[i] + 14);
+        } else if (std::strncmp(argv[i], "--threads=", 10) == 0) {
+            settings.threads = parseList(argv[i] + 10);
+        } else if (std::strncmp(argv[i], "--degree=", 9) == 0) {
+            settings.degree = std::stoi(argv[i] + 9);
+        } else if (std::strncmp(argv[i], "--seed=", 7) == 0) {
+            settings.seed = static_cast<unsigned>(std::stoul(argv[i] + 7));
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+}
+
+void registerBenchmarks() {
+    const Family families[] = {
+        Family::RandomBipartite, Family::RandomGeneral, Family::Grid, Family::PowerLaw, Family::Adversarial
+    };
+
+    for (Family family : families) {
+        for (int n : settings.sizes) {
+            std::string suffix = std::string("/") + familyName(family) + "/" + std::to_string(n);
+            benchmark::RegisterBenchmark(("isBipartite" + suffix).c_str(), benchIsBipartite, family, n)
+                ->Unit(benchmark::kMicrosecond);
+            benchmark::RegisterBenchmark(("isBipartiteDFS" + suffix).c_str(), benchIsBipartiteDFS, family, n)
+                ->Unit(benchmark::kMicrosecond);
+            benchmark::RegisterBenchmark(("findMaximumMatching" + suffix).c_str(), benchMaximumMatching, family, n)
+                ->Unit(benchmark::kMillisecond);
+            if (isBipartiteFamily(family)) {
+                benchmark::RegisterBenchmark(("findMaximumMatchingBipartite" + suffix).c_str(),
+                                             benchMaximumMatchingBipartite, family, n)
+                    ->Unit(benchmark::kMillisecond);
+                for (int threads : settings.threads) {
+                    benchmark::RegisterBenchmark(("findMaximumMatchingBipartiteParallel" + suffix + "/threads:" +
+                                                  std::to_string(threads)).c_str(),
+                                                 benchMaximumMatchingBipartiteParallel, family, n, threads)
+                        ->Unit(benchmark::kMillisecond)
+                        ->UseRealTime();
+                }
+            }
+            for (int order : kOrders) {
+                std::string reordered = suffix + "/" + orderName(order);
+                benchmark::RegisterBenchmark(("isBipartite/reordered" + reordered).c_str(),
+                                             benchReorderedIsBipartite, family, n, order)
+                    ->Unit(benchmark::kMicrosecond);
+                if (isBipartiteFamily(family)) {
+                    benchmark::RegisterBenchmark(("findMaximumMatchingBipartite/reordered" + reordered).c_str(),
+                                                 benchReorderedMatchingBipartite, family, n, order)
+                        ->Unit(benchmark::kMillisecond);
+                }
+            }
+        }
+    }
+
+    for (int n : settings.sizes) {
+        benchmark::RegisterBenchmark(("solveBottleneckAssignment/planted/" + std::to_string(n)).c_str(),
+                                     benchBottleneckAssignment, n)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("solveAssignmentProblem/planted/" + std::to_string(n)).c_str(),
+                                     benchSparseAssignment, n)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("solveCapacitatedAssignment/planted/" + std::to_string(n)).c_str(),
+                                     benchCapacitatedAssignment, n)
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    for (int k : settings.denseSizes) {
+        benchmark::RegisterBenchmark(("findMaximumMatchingBipartite/dense/" + std::to_string(k)).c_str(),
+                                     benchDenseMatchingBipartite, k)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("findMaximumMatchingBipartiteParallel/dense/" + std::to_string(k) + "/threads:1").c_str(),
+                                     benchDenseMatchingBipartiteLists, k)
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    for (int k : settings.assignmentSizes) {
+        benchmark::RegisterBenchmark(("solveAssignmentProblem/dense/" + std::to_string(k)).c_str(),
+                                     benchAssignment, k)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("solveAssignmentBatch/dense/" + std::to_string(k)).c_str(),
+                                     benchAssignmentBatch, k)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("findKBestAssignments/dense/" + std::to_string(k)).c_str(),
+                                     benchKBestAssignments, k)
+            ->Unit(benchmark::kMillisecond);
+    }
+}
+
+}
+
+int main(int argc, char** argv) {
+    setLogSink(nullptr);
+    parseSettings(argc, argv);
+    registerBenchmarks();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
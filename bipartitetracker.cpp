@@ -0,0 +1,188 @@
+#include "bipartitetracker.h"
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <utility>
+
+BipartiteTracker::BipartiteTracker() : visitMark(0), oddComponents(0), enabled(false) {}
+
+// Начало отслеживания графа из vertexCount изолированных вершин
+void BipartiteTracker::reset(int vertexCount) {
+    parent.resize(vertexCount);
+    for (int v = 0; v < vertexCount; v++) {
+        parent[v] = v;
+    }
+    parity.assign(vertexCount, 0);
+    rank.assign(vertexCount, 0);
+    odd.assign(vertexCount, 0);
+    neighbors.assign(vertexCount, std::vector<int>());
+    visited.assign(vertexCount, 0);
+    visitMark = 0;
+    oddComponents = 0;
+    enabled = true;
+}
+
+// Прекращение отслеживания с освобождением памяти
+void BipartiteTracker::disable() noexcept {
+    *this = BipartiteTracker();
+}
+
+bool BipartiteTracker::isEnabled() const {
+    return enabled;
+}
+
+// Корень множества вершины v со сжатием пути
+// После вызова parity[v] - чётность пути от v до корня
+int BipartiteTracker::find(int v) {
+    buffer.clear();
+    int root = v;
+    while (parent[root] != root) {
+        buffer.push_back(root);
+        root = parent[root];
+    }
+
+    // Вершины обрабатываются от ближайшей к корню: их родитель уже указывает на корень
+    for (int k = static_cast<int>(buffer.size()) - 1; k >= 0; k--) {
+        int x = buffer[k];
+        if (parent[x] != root) {
+            parity[x] ^= parity[parent[x]];
+            parent[x] = root;
+        }
+    }
+    return root;
+}
+
+// Учёт ребра a - b: концы должны оказаться в разных долях
+void BipartiteTracker::unite(int a, int b) {
+    int rootA = find(a);
+    int rootB = find(b);
+    int parityA = (a == rootA) ? 0 : parity[a];
+    int parityB = (b == rootB) ? 0 : parity[b];
+
+    if (rootA == rootB) {
+        if (parityA == parityB && !odd[rootA]) {
+            odd[rootA] = 1;
+            oddComponents++;
+        }
+        return;
+    }
+
+    if (rank[rootA] < rank[rootB]) {
+        std::swap(rootA, rootB);
+    }
+    parent[rootB] = rootA;
+    parity[rootB] = parityA ^ parityB ^ 1;
+    if (rank[rootA] == rank[rootB]) {
+        rank[rootA]++;
+    }
+    if (odd[rootA] && odd[rootB]) {
+        oddComponents--;
+    }
+    odd[rootA] |= odd[rootB];
+}
+
+// Пересчёт компоненты, из которой удалено ребро a - b
+// Множества не умеют разделяться, поэтому вершины компоненты (одной или двух после
+// удаления) собираются обходом и объединяются заново по оставшимся рёбрам
+void BipartiteTracker::rebuildComponent(int a, int b) {
+    int oldRoot = find(a);
+    if (odd[oldRoot]) {
+        oddComponents--;
+    }
+
+    if (visitMark == std::numeric_limits<int>::max()) {
+        std::fill(visited.begin(), visited.end(), 0);
+        visitMark = 0;
+    }
+    int mark = ++visitMark;
+
+    std::vector<int> component;
+    for (int start : {a, b}) {
+        if (visited[start] == mark) {
+            continue;
+        }
+        visited[start] = mark;
+        size_t head = component.size();
+        component.push_back(start);
+        while (head < component.size()) {
+            int x = component[head++];
+            for (int y : neighbors[x]) {
+                if (visited[y] != mark) {
+                    visited[y] = mark;
+                    component.push_back(y);
+                }
+            }
+        }
+    }
+
+    for (int x : component) {
+        parent[x] = x;
+        parity[x] = 0;
+        rank[x] = 0;
+        odd[x] = 0;
+    }
+    for (int x : component) {
+        for (int y : neighbors[x]) {
+            if (x < y) {
+                unite(x, y);
+            }
+        }
+    }
+}
+
+// Изменения графа; при нехватке памяти отслеживание отключается,
+// и граф построит структуру заново при следующем запросе
+void BipartiteTracker::addVertex() noexcept {
+    try {
+        int v = parent.size();
+        parent.push_back(v);
+        parity.push_back(0);
+        rank.push_back(0);
+        odd.push_back(0);
+        neighbors.emplace_back();
+        visited.push_back(0);
+    } catch (const std::bad_alloc&) {
+        disable();
+    }
+}
+
+void BipartiteTracker::addEdge(int a, int b) noexcept {
+    try {
+        neighbors[a].push_back(b);
+        neighbors[b].push_back(a);
+        unite(a, b);
+    } catch (const std::bad_alloc&) {
+        disable();
+    }
+}
+
+void BipartiteTracker::removeEdge(int a, int b) noexcept {
+    try {
+        for (auto [x, y] : {std::pair<int, int>(a, b), std::pair<int, int>(b, a)}) {
+            std::vector<int>& list = neighbors[x];
+            auto it = std::find(list.begin(), list.end(), y);
+            if (it != list.end()) {
+                *it = list.back();
+                list.pop_back();
+            }
+        }
+        rebuildComponent(a, b);
+    } catch (const std::bad_alloc&) {
+        disable();
+    }
+}
+
+bool BipartiteTracker::isBipartite() const {
+    return oddComponents == 0;
+}
+
+int BipartiteTracker::getOddComponentCount() const {
+    return oddComponents;
+}
+
+// Доля вершины (0 или 1) в двуцветной раскраске её компоненты
+// Имеет смысл, только если компонента двудольна
+int BipartiteTracker::color(int v) {
+    int root = find(v);
+    return v == root ? 0 : parity[v];
+}
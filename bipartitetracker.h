@@ -0,0 +1,44 @@
+#ifndef BIPARTITETRACKER_H
+#define BIPARTITETRACKER_H
+
+#include <vector>
+
+// Поддержка двудольности при изменениях графа
+// Система непересекающихся множеств хранит для каждой вершины чётность пути до корня;
+// ребро между вершинами одной чётности в одном множестве замыкает нечётный цикл.
+// Добавление ребра - почти O(1) амортизированно, удаление пересчитывает только
+// затронутую компоненту. Направление рёбер не учитывается
+class BipartiteTracker {
+private:
+    std::vector<int> parent;
+    std::vector<unsigned char> parity;     // чётность пути до родителя
+    std::vector<int> rank;
+    std::vector<unsigned char> odd;        // у корня: в компоненте есть нечётный цикл
+    std::vector<std::vector<int>> neighbors;
+    std::vector<int> visited;
+    std::vector<int> buffer;
+    int visitMark;
+    int oddComponents;
+    bool enabled;
+
+    int find(int v);
+    void unite(int a, int b);
+    void rebuildComponent(int a, int b);
+
+public:
+    BipartiteTracker();
+
+    void reset(int vertexCount);
+    void disable() noexcept;
+    bool isEnabled() const;
+
+    void addVertex() noexcept;
+    void addEdge(int a, int b) noexcept;
+    void removeEdge(int a, int b) noexcept;
+
+    bool isBipartite() const;
+    int getOddComponentCount() const;
+    int color(int v);
+};
+
+#endif // BIPARTITETRACKER_H
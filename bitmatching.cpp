@@ -0,0 +1,96 @@
+#include "bitmatching.h"
+#include "stats.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+int lowestBit(std::uint64_t word) {
+    return __builtin_ctzll(word);
+}
+
+}
+
+int runBitMatching(int rowCount, int columnCount, AlgorithmWorkspace& workspace, int* rowMatch, int* columnMatch) {
+    std::size_t words = bitMatchingWords(columnCount);
+    const std::uint64_t* adjacency = workspace.words(AlgorithmWorkspace::AdjacencyBits).data();
+    std::vector<std::uint64_t>& visited = workspace.words(AlgorithmWorkspace::VisitedBits, words, 0);
+    std::vector<std::uint64_t>& freeColumns = workspace.words(AlgorithmWorkspace::FreeBits, words, ~std::uint64_t(0));
+    if (columnCount % 64 != 0) {
+        freeColumns[words - 1] = (std::uint64_t(1) << (columnCount % 64)) - 1;
+    }
+    std::vector<int>& parent = workspace.ints(AlgorithmWorkspace::Parent, columnCount, -1);
+    std::vector<int>& queue = workspace.cleared(AlgorithmWorkspace::Queue, rowCount);
+    std::fill(rowMatch, rowMatch + rowCount, -1);
+    std::fill(columnMatch, columnMatch + columnCount, -1);
+
+    // Жадное начальное паросочетание: первый свободный сосед строки - младший бит
+    // первого ненулевого слова (строка AND свободные)
+    int matched = 0;
+    for (int r = 0; r < rowCount; r++) {
+        const std::uint64_t* row = adjacency + r * words;
+        for (std::size_t w = 0; w < words; w++) {
+            std::uint64_t hit = row[w] & freeColumns[w];
+            if (hit != 0) {
+                int c = w * 64 + lowestBit(hit);
+                rowMatch[r] = c;
+                columnMatch[c] = r;
+                freeColumns[w] &= ~(std::uint64_t(1) << (c % 64));
+                matched++;
+                break;
+            }
+        }
+    }
+
+    // Поиск увеличивающего пути в ширину из каждой свободной строки
+    // Из слова непосещённых соседей сначала проверяются свободные: если такой есть,
+    // путь найден, не добавляя в очередь остальных
+    for (int r = 0; r < rowCount && matched < columnCount; r++) {
+        if (rowMatch[r] != -1) {
+            continue;
+        }
+        GRAPH_STAT_ADD(bfsPhases, 1);
+        std::fill(visited.begin(), visited.end(), 0);
+        queue.clear();
+        queue.push_back(r);
+        int found = -1;
+
+        for (std::size_t head = 0; head < queue.size() && found == -1; head++) {
+            int x = queue[head];
+            const std::uint64_t* row = adjacency + x * words;
+            for (std::size_t w = 0; w < words; w++) {
+                std::uint64_t fresh = row[w] & ~visited[w];
+                if (fresh == 0) {
+                    continue;
+                }
+                std::uint64_t hit = fresh & freeColumns[w];
+                if (hit != 0) {
+                    found = w * 64 + lowestBit(hit);
+                    parent[found] = x;
+                    break;
+                }
+                visited[w] |= fresh;
+                for (; fresh != 0; fresh &= fresh - 1) {
+                    int c = w * 64 + lowestBit(fresh);
+                    parent[c] = x;
+                    queue.push_back(columnMatch[c]);
+                }
+            }
+        }
+
+        if (found != -1) {
+            GRAPH_STAT_ADD(augmentingPaths, 1);
+            freeColumns[found / 64] &= ~(std::uint64_t(1) << (found % 64));
+            for (int c = found; c != -1;) {
+                int x = parent[c];
+                int next = rowMatch[x];
+                rowMatch[x] = c;
+                columnMatch[c] = x;
+                c = next;
+            }
+            matched++;
+        }
+    }
+    return matched;
+}
@@ -0,0 +1,28 @@
+#ifndef BITMATCHING_H
+#define BITMATCHING_H
+
+#include "workspace.h"
+#include <cstddef>
+
+// Плотные двудольные графы (рёбер не меньше 1 / kBitMatchingDensity от числа пар
+// долей, во второй доле от kBitMatchingMinSize вершин) findMaximumMatchingBipartiteDense
+// решает над битовой матрицей смежности, если она занимает не больше kBitMatchingMaxWords слов
+constexpr int kBitMatchingDensity = 10;
+constexpr int kBitMatchingMinSize = 64;
+constexpr std::size_t kBitMatchingMaxWords = std::size_t(1) << 22;
+
+// Число 64-битных слов в строке из columnCount столбцов
+inline std::size_t bitMatchingWords(int columnCount) {
+    return (static_cast<std::size_t>(columnCount) + 63) / 64;
+}
+
+// Максимальное паросочетание двудольного графа алгоритмом Куна над битовой матрицей
+// Строка r - первая доля, столбец c - вторая; смежность в буфере
+// workspace.words(AlgorithmWorkspace::AdjacencyBits), строка r занимает слова
+// [r * bitMatchingWords(columnCount), (r + 1) * bitMatchingWords(columnCount)).
+// Поиск в ширину берёт непосещённых соседей вершины сразу по 64 (строка AND NOT
+// посещённые) и проверяет среди них свободные одним AND со словом свободных столбцов.
+// В rowMatch и columnMatch записываются пары (-1 - свободна); возвращается размер паросочетания
+int runBitMatching(int rowCount, int columnCount, AlgorithmWorkspace& workspace, int* rowMatch, int* columnMatch);
+
+#endif // BITMATCHING_H
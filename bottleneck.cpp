@@ -0,0 +1,289 @@
+#include "bottleneck.h"
+#include "stats.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace {
+
+const int kUnreached = std::numeric_limits<int>::max();
+
+}
+
+BottleneckAssignmentSolver::BottleneckAssignmentSolver()
+    : n(0), matchedCount(0), pathLength(kUnreached), probes(0) {}
+
+// Рёбра сортируются по весу один раз, затем раскладываются по строкам подсчётом:
+// обход в порядке сортировки оставляет список каждой строки упорядоченным по рангу
+void BottleneckAssignmentSolver::build(const int* rows, const int* columns, const double* weights, std::size_t count) {
+    order.resize(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [weights](int a, int b) {
+        return weights[a] < weights[b];
+    });
+
+    rowOffsets.assign(n + 1, 0);
+    for (std::size_t k = 0; k < count; k++) {
+        rowOffsets[rows[k] + 1]++;
+    }
+    for (int i = 0; i < n; i++) {
+        rowOffsets[i + 1] += rowOffsets[i];
+    }
+
+    rowColumns.resize(count);
+    rowRanks.resize(count);
+    levels.clear();
+    next.assign(rowOffsets.begin(), rowOffsets.end() - 1);
+    for (int e : order) {
+        if (levels.empty() || weights[e] != levels.back()) {
+            levels.push_back(weights[e]);
+        }
+        int position = next[rows[e]]++;
+        rowColumns[position] = columns[e];
+        rowRanks[position] = levels.size() - 1;
+    }
+}
+
+// Наименьший ранг, при котором у каждой строки и каждого столбца есть ребро;
+// -1, если какая-то вершина изолирована
+int BottleneckAssignmentSolver::lowerBound() {
+    std::vector<int>& columnMin = distance;
+    columnMin.assign(n, kUnreached);
+    int bound = 0;
+    for (int i = 0; i < n; i++) {
+        if (rowOffsets[i] == rowOffsets[i + 1]) {
+            return -1;
+        }
+        bound = std::max(bound, rowRanks[rowOffsets[i]]);
+        for (int k = rowOffsets[i]; k < rowOffsets[i + 1]; k++) {
+            columnMin[rowColumns[k]] = std::min(columnMin[rowColumns[k]], rowRanks[k]);
+        }
+    }
+    for (int j = 0; j < n; j++) {
+        if (columnMin[j] == kUnreached) {
+            return -1;
+        }
+        bound = std::max(bound, columnMin[j]);
+    }
+    return bound;
+}
+
+// Удаление из паросочетания рёбер тяжелее порога перед пробой меньшего порога
+void BottleneckAssignmentSolver::dropAbove(int rank) {
+    for (int i = 0; i < n; i++) {
+        if (rowMatch[i] != -1 && rowMatchRank[i] > rank) {
+            columnMatch[rowMatch[i]] = -1;
+            rowMatch[i] = -1;
+            matchedCount--;
+        }
+    }
+}
+
+// Разбиение строк на слои поиском в ширину от свободных строк
+// Возвращает true, если достижим свободный столбец; pathLength - длина кратчайших путей
+bool BottleneckAssignmentSolver::layer(int rank) {
+    GRAPH_STAT_ADD(bfsPhases, 1);
+    queue.assign(freeRows.begin(), freeRows.end());
+    for (int i : freeRows) {
+        distance[i] = 0;
+    }
+
+    pathLength = kUnreached;
+    for (std::size_t head = 0; head < queue.size(); head++) {
+        int u = queue[head];
+        next[u] = rowOffsets[u];
+        if (distance[u] >= pathLength) {
+            continue;
+        }
+        for (int k = rowOffsets[u]; k < rowOffsets[u + 1] && rowRanks[k] <= rank; k++) {
+            GRAPH_STAT_ADD(edgesScanned, 1);
+            int w = columnMatch[rowColumns[k]];
+            if (w == -1) {
+                pathLength = std::min(pathLength, distance[u] + 1);
+            } else if (distance[w] == kUnreached) {
+                distance[w] = distance[u] + 1;
+                queue.push_back(w);
+            }
+        }
+    }
+    return pathLength != kUnreached;
+}
+
+// Поиск кратчайшего увеличивающего пути из свободной строки root по слоям
+// Обход в глубину итеративный: next[u] - следующее непросмотренное ребро строки u,
+// на стеке - строки текущего пути. Тупиковые строки исключаются до конца фазы
+bool BottleneckAssignmentSolver::augment(int root, int rank) {
+    stack.clear();
+    stack.push_back(root);
+    while (!stack.empty()) {
+        int u = stack.back();
+        bool advanced = false;
+        while (next[u] < rowOffsets[u + 1] && rowRanks[next[u]] <= rank) {
+            int column = rowColumns[next[u]++];
+            int w = columnMatch[column];
+            if (w == -1) {
+                if (distance[u] + 1 != pathLength) {
+                    continue;
+                }
+                // Каждая строка пути берёт столбец последнего выбранного ею ребра
+                for (int row : stack) {
+                    int k = next[row] - 1;
+                    rowMatch[row] = rowColumns[k];
+                    rowMatchRank[row] = rowRanks[k];
+                    columnMatch[rowColumns[k]] = row;
+                }
+                return true;
+            }
+            if (distance[w] == distance[u] + 1) {
+                stack.push_back(w);
+                advanced = true;
+                break;
+            }
+        }
+        if (!advanced) {
+            distance[u] = kUnreached;
+            stack.pop_back();
+        }
+    }
+    return false;
+}
+
+// Максимальное паросочетание на рёбрах с рангом не выше rank, начиная с текущего
+// Возвращает true, если оно совершенное
+bool BottleneckAssignmentSolver::probe(int rank) {
+    probes++;
+    dropAbove(rank);
+
+    // Жадное дополнение в духе Карпа-Сипсера: строки по возрастанию степени, каждой -
+    // свободный столбец наименьшей степени. На разреженных графах это оставляет
+    // Хопкрофту-Карпу заметно меньше свободных строк, чем обход в порядке номеров
+    std::vector<int>& columnDegree = distance;
+    std::fill(columnDegree.begin(), columnDegree.end(), 0);
+    order.assign(n + 1, 0);
+    for (int i = 0; i < n; i++) {
+        int degree = 0;
+        for (int k = rowOffsets[i]; k < rowOffsets[i + 1] && rowRanks[k] <= rank; k++) {
+            columnDegree[rowColumns[k]]++;
+            degree++;
+        }
+        next[i] = degree;
+        order[std::min(degree, n)]++;
+    }
+    for (int d = 0, start = 0; d <= n; d++) {
+        int count = order[d];
+        order[d] = start;
+        start += count;
+    }
+    queue.resize(n);
+    for (int i = 0; i < n; i++) {
+        queue[order[std::min(next[i], n)]++] = i;
+    }
+    for (int i : queue) {
+        if (rowMatch[i] != -1) {
+            continue;
+        }
+        int bestColumn = -1;
+        int bestRank = -1;
+        for (int k = rowOffsets[i]; k < rowOffsets[i + 1] && rowRanks[k] <= rank; k++) {
+            int column = rowColumns[k];
+            if (columnMatch[column] == -1 && (bestColumn == -1 || columnDegree[column] < columnDegree[bestColumn])) {
+                bestColumn = column;
+                bestRank = rowRanks[k];
+            }
+        }
+        if (bestColumn != -1) {
+            rowMatch[i] = bestColumn;
+            rowMatchRank[i] = bestRank;
+            columnMatch[bestColumn] = i;
+            matchedCount++;
+        }
+    }
+    std::fill(distance.begin(), distance.end(), kUnreached);
+    queue.clear();
+
+    freeRows.clear();
+    for (int i = 0; i < n; i++) {
+        if (rowMatch[i] == -1) {
+            freeRows.push_back(i);
+        }
+    }
+
+    while (!freeRows.empty() && layer(rank)) {
+        for (int i : freeRows) {
+            if (augment(i, rank)) {
+                GRAPH_STAT_ADD(augmentingPaths, 1);
+                matchedCount++;
+            }
+        }
+        for (int u : queue) {
+            distance[u] = kUnreached;
+        }
+        freeRows.erase(std::remove_if(freeRows.begin(), freeRows.end(), [this](int i) {
+            return rowMatch[i] != -1;
+        }), freeRows.end());
+    }
+    for (int u : queue) {
+        distance[u] = kUnreached;
+    }
+    return matchedCount == n;
+}
+
+bool BottleneckAssignmentSolver::solve(int n, const int* rows, const int* columns, const double* weights,
+                                       std::size_t count, int* assignment, double& bottleneck) {
+    GRAPH_STAT_TIMER(assignmentSolveSeconds);
+    this->n = n;
+    probes = 0;
+    bottleneck = 0.0;
+    if (n == 0) {
+        return true;
+    }
+
+    build(rows, columns, weights, count);
+    rowMatch.assign(n, -1);
+    rowMatchRank.assign(n, -1);
+    columnMatch.assign(n, -1);
+    matchedCount = 0;
+
+    int low = lowerBound();
+    if (low < 0) {
+        return false;
+    }
+    distance.assign(n, kUnreached);
+    next.resize(n);
+
+    // Каждая проба продолжает паросочетание предыдущей: после неудачной пробы оно
+    // допустимо для больших порогов, после удачной - обрезается до меньшего порога
+    int best = -1;
+    if (probe(low)) {
+        best = low;
+        bestMatch = rowMatch;
+    } else {
+        int high = levels.size() - 1;
+        low++;
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (probe(mid)) {
+                high = mid;
+                best = mid;
+                bestMatch = rowMatch;
+            } else {
+                low = mid + 1;
+            }
+        }
+        if (best != low) {
+            if (low >= static_cast<int>(levels.size()) || !probe(low)) {
+                return false;
+            }
+            best = low;
+            bestMatch = rowMatch;
+        }
+    }
+
+    std::copy(bestMatch.begin(), bestMatch.end(), assignment);
+    bottleneck = levels[best];
+    return true;
+}
+
+int BottleneckAssignmentSolver::getProbeCount() const {
+    return probes;
+}
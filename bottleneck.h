@@ -0,0 +1,63 @@
+#ifndef BOTTLENECK_H
+#define BOTTLENECK_H
+
+#include <cstddef>
+#include <vector>
+
+// Задача о назначениях на узкое место: совершенное паросочетание строк 0 .. n - 1
+// со столбцами 0 .. n - 1, у которого наибольший вес ребра минимален.
+// Различные веса сортируются, порог ищется двоичным поиском; на каждом пороге
+// паросочетание достраивается алгоритмом Хопкрофта-Карпа от найденного на прошлом шаге.
+// Рёбра строки хранятся по возрастанию веса, поэтому допустимые при пороге рёбра -
+// префикс списка строки, и граф между пробами не перестраивается.
+// Буферы сохраняются между вызовами solve()
+class BottleneckAssignmentSolver {
+private:
+    int n;
+
+    // Рёбра строки i: rowColumns[rowOffsets[i] .. rowOffsets[i + 1]) по возрастанию ранга
+    // веса; ранг - номер веса в отсортированном массиве различных весов levels
+    std::vector<int> rowOffsets;
+    std::vector<int> rowColumns;
+    std::vector<int> rowRanks;
+    std::vector<double> levels;
+
+    // Текущее паросочетание: столбец строки, ранг его ребра и строка столбца (-1 - свободны)
+    std::vector<int> rowMatch;
+    std::vector<int> rowMatchRank;
+    std::vector<int> columnMatch;
+    int matchedCount;
+
+    // Буферы Хопкрофта-Карпа. Фаза затрагивает только свободные строки и достигнутые
+    // из них: distance и next сбрасываются лишь для строк из queue
+    std::vector<int> freeRows;
+    std::vector<int> distance;
+    std::vector<int> queue;
+    std::vector<int> next;
+    std::vector<int> stack;
+    std::vector<int> order;
+    std::vector<int> bestMatch;
+    int pathLength;
+    int probes;
+
+    void build(const int* rows, const int* columns, const double* weights, std::size_t count);
+    int lowerBound();
+    void dropAbove(int rank);
+    bool layer(int rank);
+    bool augment(int root, int rank);
+    bool probe(int rank);
+
+public:
+    BottleneckAssignmentSolver();
+
+    // count рёбер (rows[k], columns[k], weights[k]) двудольного графа n x n; кратные рёбра допустимы
+    // Если совершенного паросочетания нет, возвращается false. Иначе в assignment[i] -
+    // столбец строки i, а в bottleneck - наибольший вес ребра назначения
+    bool solve(int n, const int* rows, const int* columns, const double* weights, std::size_t count,
+               int* assignment, double& bottleneck);
+
+    // Число проверок порога при последнем вызове solve()
+    int getProbeCount() const;
+};
+
+#endif // BOTTLENECK_H
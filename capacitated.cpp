@@ -0,0 +1,223 @@
+#include "capacitated.h"
+#include "stats.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace {
+
+const double kInfinity = std::numeric_limits<double>::infinity();
+
+}
+
+CapacitatedAssignmentSolver::CapacitatedAssignmentSolver()
+    : nodeCount(0), source(0), sink(0), tolerance(0.0), phases(0) {}
+
+// Узлы: строки 0 .. rowCount - 1, столбцы rowCount .. rowCount + columnCount - 1, исток, сток
+// Начальные потенциалы делают приведённые стоимости неотрицательными и при
+// отрицательных стоимостях: потенциал столбца - наименьшая стоимость входящей пары
+void CapacitatedAssignmentSolver::build(int rowCount, const int* rowCapacity, int columnCount,
+                                        const int* columnCapacity, const int* rows, const int* columns,
+                                        const double* costs, std::size_t count) {
+    nodeCount = rowCount + columnCount + 2;
+    source = rowCount + columnCount;
+    sink = source + 1;
+
+    std::size_t arcCount = 2 * (count + rowCount + columnCount);
+    arcTo.resize(arcCount);
+    arcResidual.resize(arcCount);
+    arcCost.resize(arcCount);
+    std::size_t a = 0;
+    auto addArc = [&](int from, int to, int capacity, double cost) {
+        arcTo[a] = to;
+        arcResidual[a] = capacity;
+        arcCost[a] = cost;
+        arcTo[a + 1] = from;
+        arcResidual[a + 1] = 0;
+        arcCost[a + 1] = -cost;
+        a += 2;
+    };
+
+    double maxAbsCost = 0.0;
+    potential.assign(nodeCount, 0.0);
+    std::vector<unsigned char>& hasPair = finalized;
+    hasPair.assign(columnCount, 0);
+    for (std::size_t k = 0; k < count; k++) {
+        int column = rowCount + columns[k];
+        addArc(rows[k], column, 1, costs[k]);
+        maxAbsCost = std::max(maxAbsCost, std::fabs(costs[k]));
+        if (!hasPair[columns[k]] || costs[k] < potential[column]) {
+            potential[column] = costs[k];
+            hasPair[columns[k]] = 1;
+        }
+    }
+    potential[sink] = 0.0;
+    for (int i = 0; i < rowCount; i++) {
+        addArc(source, i, rowCapacity[i], 0.0);
+    }
+    for (int j = 0; j < columnCount; j++) {
+        addArc(rowCount + j, sink, columnCapacity[j], 0.0);
+        potential[sink] = std::min(potential[sink], potential[rowCount + j]);
+    }
+    tolerance = 1e-9 * (1.0 + maxAbsCost);
+
+    // Дуги по узлам подсчётом; начало дуги a - конец обратной дуги a ^ 1
+    arcOffsets.assign(nodeCount + 1, 0);
+    for (std::size_t b = 0; b < arcCount; b++) {
+        arcOffsets[arcTo[b ^ 1] + 1]++;
+    }
+    for (int u = 0; u < nodeCount; u++) {
+        arcOffsets[u + 1] += arcOffsets[u];
+    }
+    arcList.resize(arcCount);
+    current.assign(arcOffsets.begin(), arcOffsets.end() - 1);
+    for (std::size_t b = 0; b < arcCount; b++) {
+        arcList[current[arcTo[b ^ 1]]++] = b;
+    }
+}
+
+double CapacitatedAssignmentSolver::reducedCost(int arc, int from) const {
+    return arcCost[arc] + potential[from] - potential[arcTo[arc]];
+}
+
+// Дейкстра от истока до извлечения стока. Новые потенциалы: расстояние для извлечённых
+// узлов и расстояние до стока для остальных - приведённые стоимости остаются
+// неотрицательными, а на кратчайших путях становятся нулевыми
+bool CapacitatedAssignmentSolver::shortestPaths() {
+    distance.assign(nodeCount, kInfinity);
+    finalized.assign(nodeCount, 0);
+    heap.clear();
+    distance[source] = 0.0;
+    heap.push_back({0.0, source});
+    std::greater<std::pair<double, int>> later;
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        int u = heap.back().second;
+        heap.pop_back();
+        if (finalized[u]) {
+            continue;
+        }
+        finalized[u] = 1;
+        if (u == sink) {
+            break;
+        }
+        GRAPH_STAT_ADD(edgesScanned, arcOffsets[u + 1] - arcOffsets[u]);
+        for (int k = arcOffsets[u]; k < arcOffsets[u + 1]; k++) {
+            int arc = arcList[k];
+            int v = arcTo[arc];
+            if (arcResidual[arc] == 0 || finalized[v]) {
+                continue;
+            }
+            // Погрешность округления не должна давать отрицательных длин
+            double candidate = distance[u] + std::max(0.0, reducedCost(arc, u));
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                heap.push_back({candidate, v});
+                std::push_heap(heap.begin(), heap.end(), later);
+            }
+        }
+    }
+
+    if (!finalized[sink]) {
+        return false;
+    }
+    GRAPH_STAT_ADD(dualUpdates, 1);
+    for (int v = 0; v < nodeCount; v++) {
+        potential[v] += finalized[v] ? distance[v] : distance[sink];
+    }
+    return true;
+}
+
+// Блокирующий поток по допустимым дугам итеративным обходом в глубину
+// current[u] - следующая непросмотренная дуга узла; дуги к узлам текущего пути
+// пропускаются, тупиковые узлы исключаются до конца фазы. Возвращает объём потока
+int CapacitatedAssignmentSolver::blockingFlow() {
+    current.assign(arcOffsets.begin(), arcOffsets.end() - 1);
+    onPath.assign(nodeCount, 0);
+    dead.assign(nodeCount, 0);
+    pathNodes.assign(1, source);
+    pathArcs.clear();
+    onPath[source] = 1;
+    int pushed = 0;
+
+    while (!pathNodes.empty()) {
+        int u = pathNodes.back();
+        if (u == sink) {
+            int amount = std::numeric_limits<int>::max();
+            for (int arc : pathArcs) {
+                amount = std::min(amount, arcResidual[arc]);
+            }
+            for (int arc : pathArcs) {
+                arcResidual[arc] -= amount;
+                arcResidual[arc ^ 1] += amount;
+            }
+            GRAPH_STAT_ADD(augmentingPaths, 1);
+            pushed += amount;
+            for (int v : pathNodes) {
+                onPath[v] = 0;
+            }
+            pathNodes.assign(1, source);
+            pathArcs.clear();
+            onPath[source] = 1;
+            continue;
+        }
+
+        bool advanced = false;
+        for (; current[u] < arcOffsets[u + 1]; current[u]++) {
+            int arc = arcList[current[u]];
+            int v = arcTo[arc];
+            if (arcResidual[arc] > 0 && !onPath[v] && !dead[v] && reducedCost(arc, u) <= tolerance) {
+                pathNodes.push_back(v);
+                pathArcs.push_back(arc);
+                onPath[v] = 1;
+                advanced = true;
+                break;
+            }
+        }
+        if (!advanced) {
+            dead[u] = 1;
+            onPath[u] = 0;
+            pathNodes.pop_back();
+            if (!pathArcs.empty()) {
+                pathArcs.pop_back();
+                current[pathNodes.back()]++;
+            }
+        }
+    }
+    return pushed;
+}
+
+double CapacitatedAssignmentSolver::solve(int rowCount, const int* rowCapacity, int columnCount,
+                                          const int* columnCapacity, const int* rows, const int* columns,
+                                          const double* costs, std::size_t count,
+                                          unsigned char* used, int& assignedCount) {
+    GRAPH_STAT_TIMER(assignmentSolveSeconds);
+    phases = 0;
+    build(rowCount, rowCapacity, columnCount, columnCapacity, rows, columns, costs, count);
+
+    // Стоимость кратчайшего пути не убывает от фазы к фазе, поэтому поток каждой
+    // величины - минимальной стоимости, а последний - максимальный
+    while (shortestPaths()) {
+        phases++;
+        if (blockingFlow() == 0) {
+            break;
+        }
+    }
+
+    double total = 0.0;
+    assignedCount = 0;
+    for (std::size_t k = 0; k < count; k++) {
+        used[k] = arcResidual[2 * k] == 0;
+        if (used[k]) {
+            total += costs[k];
+            assignedCount++;
+        }
+    }
+    return total;
+}
+
+int CapacitatedAssignmentSolver::getPhaseCount() const {
+    return phases;
+}
@@ -0,0 +1,69 @@
+#ifndef CAPACITATED_H
+#define CAPACITATED_H
+
+#include <cstddef>
+#include <vector>
+
+// Задача о назначениях с ёмкостями (b-паросочетание минимальной стоимости):
+// строка i может получить до rowCapacity[i] столбцов, столбец j - до columnCapacity[j]
+// строк, каждая пара используется не больше одного раза. Ищется назначение наибольшего
+// размера, а среди таких - наименьшей стоимости.
+//
+// Решается как поток минимальной стоимости в сети исток -> строки -> столбцы -> сток
+// без размножения вершин: ёмкость вершины - ёмкость одной дуги из истока или в сток.
+// Каждая фаза - Дейкстра по приведённым стоимостям с потенциалами, затем блокирующий
+// поток по допустимым дугам (приведённая стоимость 0), как в прямо-двойственном методе,
+// поэтому одна фаза проводит сразу все кратчайшие увеличивающие пути.
+// Буферы сохраняются между вызовами solve()
+class CapacitatedAssignmentSolver {
+private:
+    int nodeCount;
+    int source;
+    int sink;
+
+    // Дуги парами: дуга a и обратная a ^ 1; дуги пары k - 2k и 2k + 1
+    std::vector<int> arcTo;
+    std::vector<int> arcResidual;
+    std::vector<double> arcCost;
+
+    // Дуги узла u: arcList[arcOffsets[u] .. arcOffsets[u + 1])
+    std::vector<int> arcOffsets;
+    std::vector<int> arcList;
+
+    std::vector<double> potential;
+    std::vector<double> distance;
+    std::vector<unsigned char> finalized;
+    std::vector<std::pair<double, int>> heap;
+
+    // Блокирующий поток: текущая дуга узла, узлы на пути, тупиковые узлы
+    std::vector<int> current;
+    std::vector<unsigned char> onPath;
+    std::vector<unsigned char> dead;
+    std::vector<int> pathNodes;
+    std::vector<int> pathArcs;
+
+    double tolerance;
+    int phases;
+
+    void build(int rowCount, const int* rowCapacity, int columnCount, const int* columnCapacity,
+               const int* rows, const int* columns, const double* costs, std::size_t count);
+    double reducedCost(int arc, int from) const;
+    bool shortestPaths();
+    int blockingFlow();
+
+public:
+    CapacitatedAssignmentSolver();
+
+    // count различных пар (rows[k], columns[k]) со стоимостями costs[k]; стоимости могут
+    // быть отрицательными. В used[k] записывается 1 для выбранных пар, в assignedCount -
+    // их число; возвращается стоимость назначения (точность сравнений - 1e-9 относительно
+    // наибольшей стоимости)
+    double solve(int rowCount, const int* rowCapacity, int columnCount, const int* columnCapacity,
+                 const int* rows, const int* columns, const double* costs, std::size_t count,
+                 unsigned char* used, int& assignedCount);
+
+    // Число фаз (поисков кратчайших путей) при последнем вызове solve()
+    int getPhaseCount() const;
+};
+
+#endif // CAPACITATED_H
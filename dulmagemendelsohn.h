@@ -0,0 +1,33 @@
+#ifndef DULMAGEMENDELSOHN_H
+#define DULMAGEMENDELSOHN_H
+
+#include <cstddef>
+#include <vector>
+
+// Разложение Дюлмажа-Мендельсона двудольного графа, построенное по максимальному
+// паросочетанию. Доли - как в findMaximumMatchingBipartite (partition 0 и 1).
+//
+// Грубое разложение: вершины, достижимые чередующимися путями из свободных вершин
+// первой доли (FirstSurplus) или второй (SecondSurplus), и остальные, совершенно
+// сочетаемые между собой (Square). Тонкое разложение Square - сильно связные компоненты
+// орграфа с рёбрами не из паросочетания в одну сторону и рёбрами паросочетания в другую.
+// Ребро входит хотя бы в одно максимальное паросочетание, если оно в найденном
+// паросочетании, лежит внутри FirstSurplus или SecondSurplus или внутри одного блока Square
+struct DulmageMendelsohn {
+    enum Part : unsigned char {
+        FirstSurplus,
+        Square,
+        SecondSurplus
+    };
+
+    // По плотным индексам вершин: часть грубого разложения и номер блока Square (-1 вне Square)
+    std::vector<unsigned char> part;
+    std::vector<int> block;
+    int blockCount = 0;
+
+    // По индексам рёбер графа (edgeAt): может ли ребро войти в максимальное паросочетание
+    std::vector<unsigned char> allowedEdge;
+    std::size_t allowedEdgeCount = 0;
+};
+
+#endif // DULMAGEMENDELSOHN_H
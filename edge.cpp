@@ -1,25 +1,77 @@
 #include "edge.h"
+#include "logsink.h"
+#include "parsing.h"
+#include <string>
 #include <iostream>
 #include <stdexcept>
 
 Edge::Edge() : fromId(0), toId(0), weight(1.0), isDirected(false) {}
 
 Edge::Edge(int fromId, int toId, double weight, bool isDirected) : fromId(fromId), toId(toId), weight(weight), isDirected(isDirected) {
+    GraphError error = validate(fromId, toId, weight);
+    if (error != GraphError::None) {
+        throw std::invalid_argument(errorMessage(error));
+    }
+}
+
+// Проверка параметров ребра без исключений
+GraphError Edge::validate(int fromId, int toId, double weight) noexcept {
     if (fromId < 0) {
-        throw std::invalid_argument("ID вершины-источника не может быть отрицательным");
+        return GraphError::NegativeSourceId;
     }
 
     if (toId < 0) {
-        throw std::invalid_argument("ID вершины-назначения не может быть отрицательным");
+        return GraphError::NegativeTargetId;
     }
 
     if (fromId == toId) {
-        throw std::invalid_argument("Самопетля недопустима");
+        return GraphError::SelfLoop;
     }
 
-    if (weight <= 0) {
-        throw std::invalid_argument("Вес ребра должен быть положительным числом");
+    if (!(weight > 0)) {
+        return GraphError::NonPositiveWeight;
+    }
+
+    return GraphError::None;
+}
+
+// Разбор ребра из строки формата "1 2 5.5 0" без исключений
+// При ошибке edge не изменяется
+GraphError Edge::parse(std::string_view text, Edge& edge) noexcept {
+    std::string_view token;
+    int tempFromId, tempToId;
+    double tempWeight;
+    int tempDirected;
+
+    if (!nextToken(text, token) || !parseInt(token, tempFromId)) {
+        return GraphError::ParseError;
+    }
+    if (!nextToken(text, token) || !parseInt(token, tempToId)) {
+        return GraphError::ParseError;
+    }
+    if (!nextToken(text, token) || !parseDouble(token, tempWeight)) {
+        return GraphError::ParseError;
+    }
+    if (!nextToken(text, token) || !parseInt(token, tempDirected)) {
+        return GraphError::ParseError;
     }
+    if (nextToken(text, token)) {
+        return GraphError::ParseError;
+    }
+
+    GraphError error = validate(tempFromId, tempToId, tempWeight);
+    if (error != GraphError::None) {
+        return error;
+    }
+    if (tempDirected != 0 && tempDirected != 1) {
+        return GraphError::InvalidDirectedFlag;
+    }
+
+    edge.fromId = tempFromId;
+    edge.toId = tempToId;
+    edge.weight = tempWeight;
+    edge.isDirected = (tempDirected == 1);
+    return GraphError::None;
 }
 
 int Edge::getFromId() const {
@@ -84,7 +136,7 @@ std::ostream& operator<<(std::ostream& os, const Edge& edge) {
 
         return os;
     } catch (const std::ios_base::failure& e) {
-        std::cerr << "Ошибка ввода/вывода: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка ввода/вывода: ") + e.what());
         throw;
     }
 }
@@ -139,11 +191,11 @@ std::istream& operator>>(std::istream& is, Edge& edge) {
         return is;
 
     } catch (const std::invalid_argument& e) {
-        std::cerr << "Ошибка при вводе ребра: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка при вводе ребра: ") + e.what());
         is.setstate(std::ios_base::failbit);
         throw;
     } catch (const std::exception& e) {
-        std::cerr << "Неожиданная ошибка при вводе ребра: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Неожиданная ошибка при вводе ребра: ") + e.what());
         is.setstate(std::ios_base::failbit);
         throw;
     }
@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <string_view>
+#include "status.h"
 
 class Edge {
 private:
@@ -14,6 +16,8 @@ private:
 public:
     Edge();
     Edge(int fromId, int toId, double weight = 1.0, bool isDirected = false);
+    static GraphError validate(int fromId, int toId, double weight) noexcept;
+    static GraphError parse(std::string_view text, Edge& edge) noexcept;
     int getFromId() const;
     int getToId() const;
     double getWeight() const;
@@ -0,0 +1,39 @@
+#ifndef GALLAIEDMONDS_H
+#define GALLAIEDMONDS_H
+
+#include <vector>
+
+// Разложение Галлаи-Эдмондса графа по максимальному паросочетанию и двойственный
+// сертификат его максимальности (формула Татта-Бержа).
+//
+// D - вершины, не покрытые хотя бы одним максимальным паросочетанием (внешние вершины
+// леса Эдмондса из всех свободных вершин), A - соседи D вне D, C - остальные вершины.
+// Компоненты D нечётны, компоненты C чётны и совершенно сочетаемы.
+//
+// Сертификат: вершины coverVertices (вес 1) и нечётные множества (вес 1, ёмкость
+// (|S| - 1) / 2) вместе покрывают все рёбра: каждое ребро касается вершины покрытия
+// или лежит внутри одного множества. Поэтому любое паросочетание не больше dualValue,
+// а для найденного паросочетания dualValue равно его размеру
+struct GallaiEdmonds {
+    enum Kind : unsigned char {
+        D,
+        A,
+        C
+    };
+
+    // По плотным индексам вершин
+    std::vector<unsigned char> kind;
+
+    // Вершины покрытия: A и по одной вершине из каждой компоненты C
+    std::vector<int> coverVertices;
+
+    // Нечётные множества подряд: множество s - oddSetVertices[oddSetOffsets[s] .. oddSetOffsets[s + 1])
+    // Компоненты D и компоненты C без вершины покрытия
+    std::vector<int> oddSetOffsets;
+    std::vector<int> oddSetVertices;
+
+    // |coverVertices| + сумма (|S| - 1) / 2 по нечётным множествам
+    int dualValue = 0;
+};
+
+#endif // GALLAIEDMONDS_H
@@ -0,0 +1,393 @@
+#include "generators.h"
+#include "graph.h"
+#include "parallel.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <ostream>
+#include <string>
+
+namespace {
+
+// Размеры блоков фиксированы, чтобы результат не зависел от числа потоков:
+// каждый блок получает собственный генератор, производный от seed и номера блока
+const std::size_t kEdgeChunk = 1 << 16;
+const int kRowChunk = 64;
+const std::size_t kWriteChunk = 1 << 15;
+
+// Старшие 64 бита произведения a * b через 32-битные половины множителей
+std::uint64_t multiplyHigh(std::uint64_t a, std::uint64_t b) {
+    const std::uint64_t mask = 0xFFFFFFFFull;
+    std::uint64_t lowLow = (a & mask) * (b & mask);
+    std::uint64_t lowHigh = (a & mask) * (b >> 32);
+    std::uint64_t highLow = (a >> 32) * (b & mask);
+    std::uint64_t highHigh = (a >> 32) * (b >> 32);
+    std::uint64_t middle = (lowLow >> 32) + (lowHigh & mask) + (highLow & mask);
+    return highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+}
+
+// Генератор SplitMix64: быстрый, с состоянием в одно слово
+class SplitMix64 {
+private:
+    std::uint64_t state;
+
+public:
+    explicit SplitMix64(std::uint64_t seed) : state(seed) {}
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Равномерное число из [0, 1)
+    double uniform() {
+        return (next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Равномерное целое из [0, range): старшее слово произведения next() * range
+    std::uint64_t below(std::uint64_t range) {
+        return multiplyHigh(next(), range);
+    }
+};
+
+// Независимый поток случайных чисел для блока chunk генератора stream
+SplitMix64 chunkRng(std::uint64_t seed, std::uint64_t stream, std::uint64_t chunk) {
+    // Начальное состояние блока перемешивается, иначе потоки соседних блоков
+    // оказались бы сдвигами одной и той же последовательности
+    SplitMix64 mixer(seed ^ (stream * 0xD1B54A32D192ED03ull));
+    SplitMix64 chunkMixer(mixer.next() ^ (chunk * 0xD6E8FEB86659FD93ull));
+    return SplitMix64(chunkMixer.next());
+}
+
+double randomWeight(SplitMix64& rng, const GeneratorOptions& options) {
+    if (options.integerWeights) {
+        double low = std::ceil(options.minWeight);
+        double high = std::floor(options.maxWeight);
+        if (high <= low) {
+            return low;
+        }
+        return low + static_cast<double>(rng.below(static_cast<std::uint64_t>(high - low) + 1));
+    }
+    if (options.maxWeight <= options.minWeight) {
+        return options.minWeight;
+    }
+    return options.minWeight + rng.uniform() * (options.maxWeight - options.minWeight);
+}
+
+void resizeEdges(EdgeList& edges, std::size_t m) {
+    edges.from.resize(m);
+    edges.to.resize(m);
+    edges.weight.resize(m);
+}
+
+// Генерация m рёбер поблочно: pick(rng, u, v) выбирает концы одного ребра
+template <typename Pick>
+void fillEdges(EdgeList& edges, std::size_t offset, std::size_t m, std::uint64_t stream,
+               const GeneratorOptions& options, Pick pick) {
+    std::size_t chunks = (m + kEdgeChunk - 1) / kEdgeChunk;
+    forEachChunk(chunks, options.threads, [&](std::size_t chunk) {
+        SplitMix64 rng = chunkRng(options.seed, stream, chunk);
+        std::size_t begin = chunk * kEdgeChunk;
+        std::size_t end = std::min(m, begin + kEdgeChunk);
+        for (std::size_t e = begin; e < end; e++) {
+            int u, v;
+            pick(rng, u, v);
+            edges.from[offset + e] = u;
+            edges.to[offset + e] = v;
+            edges.weight[offset + e] = randomWeight(rng, options);
+        }
+    });
+}
+
+// Форматирование блоков строк в нескольких потоках и последовательная запись в поток
+// Блоки обрабатываются волнами, чтобы не держать в памяти весь текст сразу
+template <typename Format>
+bool writeChunked(std::ostream& os, std::size_t chunkCount, int threads, Format format) {
+    std::size_t wave = static_cast<std::size_t>(resolveThreads(threads)) * 4;
+    std::vector<std::string> buffers(wave);
+
+    for (std::size_t first = 0; first < chunkCount; first += wave) {
+        std::size_t count = std::min(wave, chunkCount - first);
+        forEachChunk(count, threads, [&](std::size_t k) {
+            buffers[k].clear();
+            format(first + k, buffers[k]);
+        });
+        for (std::size_t k = 0; k < count; k++) {
+            os.write(buffers[k].data(), buffers[k].size());
+        }
+        if (!os) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void appendNumber(std::string& out, T value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+}
+
+// Случайный граф Эрдёша-Реньи G(n, m)
+// Петли перевыбираются; кратные рёбра отсекает loadIntoGraph
+EdgeList generateErdosRenyi(int n, std::size_t m, const GeneratorOptions& options) {
+    EdgeList edges;
+    edges.vertexCount = std::max(n, 0);
+    if (n < 2) {
+        return edges;
+    }
+
+    resizeEdges(edges, m);
+    fillEdges(edges, 0, m, 1, options, [n](SplitMix64& rng, int& u, int& v) {
+        u = static_cast<int>(rng.below(n));
+        do {
+            v = static_cast<int>(rng.below(n));
+        } while (v == u);
+    });
+    return edges;
+}
+
+// Случайный двудольный граф G(left, right, p)
+// Внутри строки следующее ребро находится геометрическим пропуском, поэтому
+// время пропорционально числу рёбер, а не left * right
+EdgeList generateBipartite(int left, int right, double p, const GeneratorOptions& options) {
+    EdgeList edges;
+    left = std::max(left, 0);
+    right = std::max(right, 0);
+    edges.vertexCount = left + right;
+    if (left == 0 || right == 0 || !(p > 0.0)) {
+        return edges;
+    }
+
+    std::size_t chunks = (left + kRowChunk - 1) / kRowChunk;
+    std::vector<EdgeList> parts(chunks);
+    double logSkip = p < 1.0 ? std::log1p(-p) : 0.0;
+
+    forEachChunk(chunks, options.threads, [&](std::size_t chunk) {
+        SplitMix64 rng = chunkRng(options.seed, 2, chunk);
+        EdgeList& part = parts[chunk];
+        int begin = static_cast<int>(chunk) * kRowChunk;
+        int end = std::min(left, begin + kRowChunk);
+        std::size_t expected = static_cast<std::size_t>(p * right * (end - begin) * 1.1) + 16;
+        part.from.reserve(expected);
+        part.to.reserve(expected);
+        part.weight.reserve(expected);
+
+        for (int i = begin; i < end; i++) {
+            long long j = -1;
+            while (true) {
+                if (p < 1.0) {
+                    double skip = std::floor(std::log1p(-rng.uniform()) / logSkip);
+                    if (skip >= static_cast<double>(right)) {
+                        break;
+                    }
+                    j += 1 + static_cast<long long>(skip);
+                } else {
+                    j++;
+                }
+                if (j >= right) {
+                    break;
+                }
+                part.from.push_back(i);
+                part.to.push_back(left + static_cast<int>(j));
+                part.weight.push_back(randomWeight(rng, options));
+            }
+        }
+    });
+
+    std::vector<std::size_t> offsets(chunks + 1, 0);
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+        offsets[chunk + 1] = offsets[chunk] + parts[chunk].size();
+    }
+    resizeEdges(edges, offsets[chunks]);
+    forEachChunk(chunks, options.threads, [&](std::size_t chunk) {
+        EdgeList& part = parts[chunk];
+        std::copy(part.from.begin(), part.from.end(), edges.from.begin() + offsets[chunk]);
+        std::copy(part.to.begin(), part.to.end(), edges.to.begin() + offsets[chunk]);
+        std::copy(part.weight.begin(), part.weight.end(), edges.weight.begin() + offsets[chunk]);
+        part = EdgeList();
+    });
+    return edges;
+}
+
+// Граф R-MAT: каждый из scale битов номеров концов выбирается спуском
+// в один из четырёх квадрантов матрицы смежности. Петли перевыбираются
+EdgeList generateRmat(int scale, std::size_t m, double a, double b, double c, const GeneratorOptions& options) {
+    EdgeList edges;
+    if (scale < 1 || scale > 30) {
+        return edges;
+    }
+    edges.vertexCount = 1 << scale;
+
+    // Пороги квадрантов в 32-битной шкале: одно случайное слово даёт два уровня спуска
+    auto threshold = [](double value) {
+        return static_cast<std::uint32_t>(std::min(std::max(value, 0.0), 1.0) * 4294967295.0);
+    };
+    std::uint32_t ta = threshold(a);
+    std::uint32_t tab = threshold(a + b);
+    std::uint32_t tabc = threshold(a + b + c);
+
+    resizeEdges(edges, m);
+    fillEdges(edges, 0, m, 3, options, [=](SplitMix64& rng, int& u, int& v) {
+        do {
+            u = 0;
+            v = 0;
+            std::uint64_t bits = 0;
+            for (int level = 0; level < scale; level++) {
+                if (level % 2 == 0) {
+                    bits = rng.next();
+                }
+                std::uint32_t r = static_cast<std::uint32_t>(bits >> (level % 2 == 0 ? 0 : 32));
+                int row = r >= tab;
+                int column = (r >= ta && r < tab) || r >= tabc;
+                u = (u << 1) | row;
+                v = (v << 1) | column;
+            }
+        } while (u == v);
+    });
+    return edges;
+}
+
+// Двудольный граф с заложенным совершенным паросочетанием
+// Левая вершина i соединена с правой n + planted[i]; остальные рёбра случайны
+EdgeList generatePlantedMatching(int n, std::size_t extraEdges, const GeneratorOptions& options,
+                                 std::vector<int>* planted) {
+    EdgeList edges;
+    n = std::max(n, 0);
+    edges.vertexCount = 2 * n;
+    if (planted) {
+        planted->clear();
+    }
+    if (n == 0) {
+        return edges;
+    }
+
+    SplitMix64 rng = chunkRng(options.seed, 4, 0);
+    std::vector<int> permutation(n);
+    for (int i = 0; i < n; i++) {
+        permutation[i] = i;
+    }
+    for (int i = n - 1; i > 0; i--) {
+        std::swap(permutation[i], permutation[rng.below(i + 1)]);
+    }
+
+    std::size_t m = static_cast<std::size_t>(n) + extraEdges;
+    resizeEdges(edges, m);
+    for (int i = 0; i < n; i++) {
+        edges.from[i] = i;
+        edges.to[i] = n + permutation[i];
+        edges.weight[i] = randomWeight(rng, options);
+    }
+    fillEdges(edges, n, extraEdges, 5, options, [n](SplitMix64& random, int& u, int& v) {
+        u = static_cast<int>(random.below(n));
+        v = n + static_cast<int>(random.below(n));
+    });
+
+    // Перемешивание, чтобы заложенные рёбра не шли первыми и не подсказывали жадному поиску
+    for (std::size_t e = m - 1; e > 0; e--) {
+        std::size_t k = rng.below(e + 1);
+        std::swap(edges.from[e], edges.from[k]);
+        std::swap(edges.to[e], edges.to[k]);
+        std::swap(edges.weight[e], edges.weight[k]);
+    }
+
+    if (planted) {
+        *planted = std::move(permutation);
+    }
+    return edges;
+}
+
+// Плотная матрица стоимостей n x n со значениями из [minWeight, maxWeight]
+std::vector<double> generateCostMatrix(int n, const GeneratorOptions& options) {
+    n = std::max(n, 0);
+    std::vector<double> costs(static_cast<std::size_t>(n) * n);
+    std::size_t chunks = (n + kRowChunk - 1) / kRowChunk;
+    forEachChunk(chunks, options.threads, [&](std::size_t chunk) {
+        SplitMix64 rng = chunkRng(options.seed, 6, chunk);
+        std::size_t begin = chunk * kRowChunk * static_cast<std::size_t>(n);
+        std::size_t end = std::min(costs.size(), begin + kRowChunk * static_cast<std::size_t>(n));
+        for (std::size_t k = begin; k < end; k++) {
+            costs[k] = randomWeight(rng, options);
+        }
+    });
+    return costs;
+}
+
+// Загрузка списка рёбер в граф
+// Вершины 0 .. vertexCount - 1 не должны уже присутствовать в графе
+GraphError loadIntoGraph(Graph& graph, const EdgeList& edges, bool isDirected, bool checkDuplicates) {
+    graph.reserve(graph.getVertexCount() + edges.vertexCount, graph.getEdgeCount() + edges.size());
+    GraphError error = graph.tryAddVertices(0, edges.vertexCount, 1.0);
+    if (error != GraphError::None) {
+        return error;
+    }
+
+    std::size_t added = 0;
+    return graph.tryAddEdges(edges.from.data(), edges.to.data(), edges.weight.data(), edges.size(),
+                             isDirected, checkDuplicates, added);
+}
+
+// Загрузка матрицы стоимостей как полного двудольного графа
+// Неположительные стоимости пропускаются: такие рёбра граф не принимает
+GraphError loadCostMatrix(Graph& graph, int n, const std::vector<double>& costs) {
+    if (n < 0 || costs.size() != static_cast<std::size_t>(n) * n) {
+        return GraphError::NonSquareMatrix;
+    }
+
+    EdgeList edges;
+    edges.vertexCount = 2 * n;
+    resizeEdges(edges, costs.size());
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            std::size_t k = static_cast<std::size_t>(i) * n + j;
+            edges.from[k] = i;
+            edges.to[k] = n + j;
+            edges.weight[k] = costs[k];
+        }
+    }
+    return loadIntoGraph(graph, edges, true, false);
+}
+
+bool writeEdgeList(std::ostream& os, const EdgeList& edges, bool isDirected, int threads) {
+    std::size_t chunks = (edges.size() + kWriteChunk - 1) / kWriteChunk;
+    const char* suffix = isDirected ? " 1\n" : " 0\n";
+    return writeChunked(os, chunks, threads, [&](std::size_t chunk, std::string& out) {
+        std::size_t begin = chunk * kWriteChunk;
+        std::size_t end = std::min(edges.size(), begin + kWriteChunk);
+        out.reserve((end - begin) * 32);
+        for (std::size_t e = begin; e < end; e++) {
+            appendNumber(out, edges.from[e]);
+            out += ' ';
+            appendNumber(out, edges.to[e]);
+            out += ' ';
+            appendNumber(out, edges.weight[e]);
+            out += suffix;
+        }
+    });
+}
+
+bool writeCostMatrix(std::ostream& os, int n, const std::vector<double>& costs, int threads) {
+    if (n < 0 || costs.size() != static_cast<std::size_t>(n) * n) {
+        return false;
+    }
+
+    std::size_t chunks = (n + kRowChunk - 1) / kRowChunk;
+    return writeChunked(os, chunks, threads, [&](std::size_t chunk, std::string& out) {
+        int begin = static_cast<int>(chunk) * kRowChunk;
+        int end = std::min(n, begin + kRowChunk);
+        for (int i = begin; i < end; i++) {
+            for (int j = 0; j < n; j++) {
+                if (j > 0) {
+                    out += ' ';
+                }
+                appendNumber(out, costs[static_cast<std::size_t>(i) * n + j]);
+            }
+            out += '\n';
+        }
+    });
+}
@@ -0,0 +1,67 @@
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include "status.h"
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+class Graph;
+
+// Параметры генераторов синтетических графов
+// Результат зависит только от seed: число потоков на него не влияет
+struct GeneratorOptions {
+    std::uint64_t seed = 1;
+    int threads = 0;            // 0 - по числу аппаратных потоков
+    double minWeight = 1.0;     // веса рёбер равномерно из [minWeight, maxWeight]
+    double maxWeight = 1.0;
+    bool integerWeights = false;
+};
+
+// Список рёбер в виде структуры массивов; вершины нумеруются 0 .. vertexCount - 1
+struct EdgeList {
+    int vertexCount = 0;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<double> weight;
+
+    std::size_t size() const { return from.size(); }
+};
+
+// Случайный граф Эрдёша-Реньи G(n, m) без петель (кратные рёбра возможны)
+EdgeList generateErdosRenyi(int n, std::size_t m, const GeneratorOptions& options = GeneratorOptions());
+
+// Случайный двудольный граф G(left, right, p): левая доля 0 .. left - 1,
+// правая left .. left + right - 1, каждое ребро независимо с вероятностью p
+EdgeList generateBipartite(int left, int right, double p, const GeneratorOptions& options = GeneratorOptions());
+
+// Граф R-MAT (Кронекера) на 2^scale вершинах с вероятностями квадрантов a, b, c и 1 - a - b - c
+EdgeList generateRmat(int scale, std::size_t m, double a = 0.57, double b = 0.19, double c = 0.19,
+                      const GeneratorOptions& options = GeneratorOptions());
+
+// Двудольный граф n x n с заложенным совершенным паросочетанием и extraEdges случайными рёбрами
+// Порядок рёбер перемешан; в planted (если задан) возвращается пара правой вершины для каждой левой
+EdgeList generatePlantedMatching(int n, std::size_t extraEdges, const GeneratorOptions& options = GeneratorOptions(),
+                                 std::vector<int>* planted = nullptr);
+
+// Плотная матрица стоимостей n x n по строкам
+std::vector<double> generateCostMatrix(int n, const GeneratorOptions& options = GeneratorOptions());
+
+// Загрузка списка рёбер в граф: вершины 0 .. vertexCount - 1 и рёбра пакетом
+GraphError loadIntoGraph(Graph& graph, const EdgeList& edges, bool isDirected, bool checkDuplicates = true);
+
+// Загрузка матрицы стоимостей как задачи о назначениях:
+// исполнители 0 .. n - 1, задачи n .. 2n - 1, ориентированные рёбра с весами стоимостей
+GraphError loadCostMatrix(Graph& graph, int n, const std::vector<double>& costs);
+
+// Запись списка рёбер в текстовом формате Edge::parse: "from to weight directed" по строке на ребро
+bool writeEdgeList(std::ostream& os, const EdgeList& edges, bool isDirected, int threads = 0);
+
+// Запись матрицы стоимостей n x n по строкам (строка - исполнитель, столбец - задача)
+// Это сырая матрица: обратно она загружается loadCostMatrix, которая строит двудольный граф
+// из 2n вершин. operator>> графа её не читает - он принял бы её за матрицу смежности n вершин
+// и отверг ненулевую диагональ как самопетли
+bool writeCostMatrix(std::ostream& os, int n, const std::vector<double>& costs, int threads = 0);
+
+#endif // GENERATORS_H
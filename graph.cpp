@@ -1,161 +1,660 @@
 #include "graph.h"
+#include "logsink.h"
+#include "parsing.h"
+#include "stats.h"
+#include "assignment.h"
+#include "smallassignment.h"
+#include "murty.h"
 #include <iomanip>  // Добавляем для std::setw, std::setprecision
 #include <sstream>  // Добавляем для std::istringstream
 #include <limits>
 #include <cmath>
 
-Graph::Graph() : vertices(), edges() {}
+VertexView::VertexView() : graph(nullptr), index(-1) {}
 
-void Graph::addVertex(const Vertex& vertex) {
+VertexView::VertexView(Graph* graph, int index) : graph(graph), index(index) {}
+
+int VertexView::getId() const {
+    return graph->vertexIds[index];
+}
+
+std::string_view VertexView::getLabel() const {
+    return graph->labelAt(index);
+}
+
+double VertexView::getWeight() const {
+    return graph->vertexWeights[index];
+}
+
+void VertexView::setLabel(const std::string& label) {
+    if (label.empty()) {
+        throw std::invalid_argument("Метка вершины не может быть пустой");
+    }
+    graph->vertexLabels[index] = graph->labels.intern(label);
+}
+
+void VertexView::setWeight(double weight) {
+    graph->vertexWeights[index] = weight;
+}
+
+Vertex VertexView::toVertex() const {
+    return Vertex(getId(), std::string(getLabel()), getWeight());
+}
+
+VertexView::operator Vertex() const {
+    return toVertex();
+}
+
+VertexView::operator bool() const {
+    return graph != nullptr && index >= 0;
+}
+
+VertexView* VertexView::operator->() {
+    return this;
+}
+
+const VertexView* VertexView::operator->() const {
+    return this;
+}
+
+EdgeView::EdgeView() : graph(nullptr), index(-1) {}
+
+EdgeView::EdgeView(const Graph* graph, int index) : graph(graph), index(index) {}
+
+int EdgeView::getFromId() const {
+    return graph->vertexIds[graph->edgeFrom[index]];
+}
+
+int EdgeView::getToId() const {
+    return graph->vertexIds[graph->edgeTo[index]];
+}
+
+double EdgeView::getWeight() const {
+    return graph->edgeWeights[index];
+}
+
+bool EdgeView::getIsDirected() const {
+    return graph->edgeDirected[index] != 0;
+}
+
+Edge EdgeView::toEdge() const {
+    return Edge(getFromId(), getToId(), getWeight(), getIsDirected());
+}
+
+EdgeView::operator Edge() const {
+    return toEdge();
+}
+
+EdgeView::operator bool() const {
+    return graph != nullptr && index >= 0;
+}
+
+const EdgeView* EdgeView::operator->() const {
+    return this;
+}
+
+Graph::Graph()
+    : vertexIds(), vertexWeights(), vertexLabels(), labels(),
+      edgeFrom(), edgeTo(), edgeWeights(), edgeDirected(), idToIndex(),
+      adjacencyOffsets(), adjacencyTargets(), adjacencyEdges(), adjacencyOutgoing(),
+      adjacencyValid(false) {}
+
+// Плотный индекс вершины по её внешнему ID, -1 если вершины нет
+int Graph::indexOf(int id) const noexcept {
+    auto it = idToIndex.find(id);
+    return it == idToIndex.end() ? -1 : it->second;
+}
+
+// Внешний ID вершины по плотному индексу
+int Graph::idAt(int index) const {
+    return vertexIds[index];
+}
+
+// Построение списков смежности в формате CSR по плотным индексам
+// Каждое ребро попадает в списки обоих концов в порядке добавления рёбер;
+// флаг adjacencyOutgoing отмечает записи, по которым ребро можно пройти
+// (для ориентированного ребра только от источника к назначению)
+void Graph::buildAdjacency() const {
+    if (adjacencyValid) {
+        return;
+    }
+
+    GRAPH_STAT_TIMER(adjacencySeconds);
+    GRAPH_STAT_ADD(adjacencyBuilds, 1);
+    int n = vertexIds.size();
+    int m = edgeFrom.size();
+
+    adjacencyOffsets.assign(n + 1, 0);
+    for (int e = 0; e < m; e++) {
+        adjacencyOffsets[edgeFrom[e] + 1]++;
+        adjacencyOffsets[edgeTo[e] + 1]++;
+    }
+    for (int i = 0; i < n; i++) {
+        adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+    }
+
+    adjacencyTargets.resize(2 * m);
+    adjacencyEdges.resize(2 * m);
+    adjacencyOutgoing.resize(2 * m);
+
+    std::vector<int> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (int e = 0; e < m; e++) {
+        int k = cursor[edgeFrom[e]]++;
+        adjacencyTargets[k] = edgeTo[e];
+        adjacencyEdges[k] = e;
+        adjacencyOutgoing[k] = 1;
+
+        k = cursor[edgeTo[e]]++;
+        adjacencyTargets[k] = edgeFrom[e];
+        adjacencyEdges[k] = e;
+        adjacencyOutgoing[k] = edgeDirected[e] ? 0 : 1;
+    }
+
+    adjacencyValid = true;
+}
+
+void Graph::invalidateAdjacency() {
+    adjacencyValid = false;
+}
+
+// Метка вершины по её позиции
+// Метки вида "V<id>", созданные при чтении матрицы, синтезируются только при первом обращении
+std::string_view Graph::labelAt(int index) {
+    if (vertexLabels[index] == LabelArena::kDeferred) {
+        vertexLabels[index] = labels.intern("V" + std::to_string(vertexIds[index]));
+    }
+    return labels.get(vertexLabels[index]);
+}
+
+// Добавление вершины без исключений
+// Возвращает GraphError::None при успехе; при ошибке граф не изменяется
+GraphError Graph::tryAddVertex(int id, std::string_view label, double weight) noexcept {
+    GraphError error = Vertex::validate(id, label);
+    if (error != GraphError::None) {
+        return error;
+    }
+    return insertVertex(id, label, weight);
+}
+
+// Вставка вершины с уже проверенными параметрами
+GraphError Graph::insertVertex(int id, std::string_view label, double weight) noexcept {
+    if (indexOf(id) != -1) {
+        return GraphError::DuplicateVertex;
+    }
+
+    size_t count = vertexIds.size();
     try {
-        for (const auto& v : vertices) {
-            if (v.getId() == vertex.getId()) {
-                throw std::invalid_argument(
-                    "Вершина с ID " + std::to_string(vertex.getId()) + " уже существует"
-                );
-            }
+        vertexIds.push_back(id);
+        vertexWeights.push_back(weight);
+        vertexLabels.push_back(labels.intern(label));
+        idToIndex[id] = count;
+    } catch (const std::bad_alloc&) {
+        vertexIds.resize(count);
+        vertexWeights.resize(count);
+        vertexLabels.resize(count);
+        return GraphError::OutOfMemory;
+    }
+    if (bipartiteTracker.isEnabled()) {
+        bipartiteTracker.addVertex();
+    }
+    if (matchingTracker.isEnabled()) {
+        matchingTracker.addVertex();
+    }
+    invalidateAdjacency();
+    return GraphError::None;
+}
+
+// Добавление вершин с идентификаторами firstId .. firstId + count - 1 без исключений
+// Метки "V<id>" синтезируются при первом обращении, как при чтении матрицы.
+// Если хотя бы один идентификатор занят, граф не изменяется
+GraphError Graph::tryAddVertices(int firstId, int count, double weight) noexcept {
+    if (firstId < 0 || count < 0) {
+        return GraphError::NegativeVertexId;
+    }
+    for (int k = 0; k < count; k++) {
+        if (indexOf(firstId + k) != -1) {
+            return GraphError::DuplicateVertex;
+        }
+    }
+
+    size_t previous = vertexIds.size();
+    try {
+        idToIndex.reserve(previous + count);
+        for (int k = 0; k < count; k++) {
+            vertexIds.push_back(firstId + k);
+            vertexWeights.push_back(weight);
+            vertexLabels.push_back(LabelArena::kDeferred);
+            idToIndex[firstId + k] = previous + k;
+        }
+    } catch (const std::bad_alloc&) {
+        for (size_t i = previous; i < vertexIds.size(); i++) {
+            idToIndex.erase(vertexIds[i]);
+        }
+        vertexIds.resize(previous);
+        vertexWeights.resize(previous);
+        vertexLabels.resize(previous);
+        return GraphError::OutOfMemory;
+    }
+    for (int k = 0; k < count; k++) {
+        if (bipartiteTracker.isEnabled()) {
+            bipartiteTracker.addVertex();
+        }
+        if (matchingTracker.isEnabled()) {
+            matchingTracker.addVertex();
         }
-        vertices.push_back(vertex);
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Ошибка при добавлении вершины: " << e.what() << std::endl;
-        throw;
     }
+    invalidateAdjacency();
+    return GraphError::None;
 }
 
-void Graph::addEdge(const Edge& edge) {
+// Добавление ребра без исключений
+GraphError Graph::tryAddEdge(int fromId, int toId, double weight, bool isDirected) noexcept {
+    GraphError error = Edge::validate(fromId, toId, weight);
+    if (error != GraphError::None) {
+        return error;
+    }
+    return insertEdge(fromId, toId, weight, isDirected);
+}
+
+// Вставка ребра с уже проверенными параметрами
+GraphError Graph::insertEdge(int fromId, int toId, double weight, bool isDirected) noexcept {
+    int from = indexOf(fromId);
+    int to = indexOf(toId);
+    if (from == -1) {
+        return GraphError::SourceNotFound;
+    }
+    if (to == -1) {
+        return GraphError::TargetNotFound;
+    }
+    for (size_t i = 0; i < edgeFrom.size(); i++) {
+        if (edgeFrom[i] == from && edgeTo[i] == to) {
+            return GraphError::DuplicateEdge;
+        }
+    }
+
+    size_t count = edgeFrom.size();
+    try {
+        edgeFrom.push_back(from);
+        edgeTo.push_back(to);
+        edgeWeights.push_back(weight);
+        edgeDirected.push_back(isDirected ? 1 : 0);
+    } catch (const std::bad_alloc&) {
+        edgeFrom.resize(count);
+        edgeTo.resize(count);
+        edgeWeights.resize(count);
+        edgeDirected.resize(count);
+        return GraphError::OutOfMemory;
+    }
+    if (bipartiteTracker.isEnabled()) {
+        bipartiteTracker.addEdge(from, to);
+    }
+    if (matchingTracker.isEnabled()) {
+        matchingTracker.addEdge(from, to);
+    }
+    invalidateAdjacency();
+    return GraphError::None;
+}
+
+// Пакетное добавление рёбер без исключений
+// Некорректные рёбра и рёбра с отсутствующими вершинами пропускаются, как и повторы
+// уже существующих или более ранних рёбер пакета (если checkDuplicates).
+// Повторы ищутся сортировкой ключей за O((m + k) log(m + k)) вместо O(m) на каждое ребро.
+// В added возвращается число добавленных рёбер
+GraphError Graph::tryAddEdges(const int* fromIds, const int* toIds, const double* weights,
+                              std::size_t count, bool isDirected, bool checkDuplicates,
+                              std::size_t& added) noexcept {
+    added = 0;
+    size_t previous = edgeFrom.size();
     try {
-        bool fromExists = false;
-        bool toExists = false;
+        std::vector<int> from(count), to(count);
+        std::vector<unsigned char> keep(count, 0);
+        for (size_t i = 0; i < count; i++) {
+            if (Edge::validate(fromIds[i], toIds[i], weights[i]) != GraphError::None) {
+                continue;
+            }
+            from[i] = indexOf(fromIds[i]);
+            to[i] = indexOf(toIds[i]);
+            keep[i] = (from[i] != -1 && to[i] != -1);
+        }
+
+        if (checkDuplicates) {
+            auto key = [](int a, int b) {
+                return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(a)) << 32) |
+                       static_cast<std::uint32_t>(b);
+            };
+
+            std::vector<std::uint64_t> existing(previous);
+            for (size_t e = 0; e < previous; e++) {
+                existing[e] = key(edgeFrom[e], edgeTo[e]);
+            }
+            std::sort(existing.begin(), existing.end());
+
+            std::vector<std::pair<std::uint64_t, std::size_t>> incoming;
+            for (size_t i = 0; i < count; i++) {
+                if (keep[i]) {
+                    incoming.push_back({key(from[i], to[i]), i});
+                }
+            }
+            std::sort(incoming.begin(), incoming.end());
 
-        for (const auto& v : vertices) {
-            if (v.getId() == edge.getFromId()) {
-                fromExists = true;
+            for (size_t k = 0; k < incoming.size(); k++) {
+                bool repeated = (k > 0 && incoming[k].first == incoming[k - 1].first) ||
+                                std::binary_search(existing.begin(), existing.end(), incoming[k].first);
+                if (repeated) {
+                    keep[incoming[k].second] = 0;
+                }
             }
-            if (v.getId() == edge.getToId()) {
-                toExists = true;
+        }
+
+        size_t total = previous;
+        for (size_t i = 0; i < count; i++) {
+            total += keep[i];
+        }
+        edgeFrom.reserve(total);
+        edgeTo.reserve(total);
+        edgeWeights.reserve(total);
+        edgeDirected.reserve(total);
+
+        for (size_t i = 0; i < count; i++) {
+            if (keep[i]) {
+                edgeFrom.push_back(from[i]);
+                edgeTo.push_back(to[i]);
+                edgeWeights.push_back(weights[i]);
+                edgeDirected.push_back(isDirected ? 1 : 0);
             }
         }
-        if (!fromExists) {
-            throw std::invalid_argument(
-                "Вершина-источник с ID " + std::to_string(edge.getFromId()) + " не найдена"
-            );
+        added = total - previous;
+    } catch (const std::bad_alloc&) {
+        edgeFrom.resize(previous);
+        edgeTo.resize(previous);
+        edgeWeights.resize(previous);
+        edgeDirected.resize(previous);
+        return GraphError::OutOfMemory;
+    }
+    if (bipartiteTracker.isEnabled()) {
+        for (size_t e = previous; e < edgeFrom.size(); e++) {
+            bipartiteTracker.addEdge(edgeFrom[e], edgeTo[e]);
+        }
+    }
+    if (matchingTracker.isEnabled()) {
+        // Большой пакет выгоднее обработать одним пересчётом, чем поиском на каждое ребро
+        bool repair = added <= static_cast<size_t>(MatchingTracker::kRecomputeThreshold);
+        for (size_t e = previous; e < edgeFrom.size(); e++) {
+            matchingTracker.addEdge(edgeFrom[e], edgeTo[e], repair);
         }
-        if (!toExists) {
-            throw std::invalid_argument(
-                "Вершина-назначение с ID " + std::to_string(edge.getToId()) + " не найдена"
-            );
+    }
+    invalidateAdjacency();
+    return GraphError::None;
+}
+
+// Резервирование памяти под ожидаемое число вершин и рёбер
+void Graph::reserve(int vertexCount, int edgeCount) {
+    vertexIds.reserve(vertexCount);
+    vertexWeights.reserve(vertexCount);
+    vertexLabels.reserve(vertexCount);
+    idToIndex.reserve(vertexCount);
+    edgeFrom.reserve(edgeCount);
+    edgeTo.reserve(edgeCount);
+    edgeWeights.reserve(edgeCount);
+    edgeDirected.reserve(edgeCount);
+}
+
+// Перестановка плотных индексов вершин: вершина со старым индексом order[k] получает индекс k
+// ID, метки, веса и порядок рёбер не меняются. Ответы алгоритмов (двудольность, размер
+// паросочетания, стоимость назначения) от порядка не зависят и на ориентированных графах;
+// при нескольких оптимумах может быть выбран другой. Плотные результаты после
+// перестановки относятся к новым индексам
+void Graph::reorderVertices(const std::vector<int>& order) {
+    try {
+        int n = vertexIds.size();
+        if (static_cast<int>(order.size()) != n) {
+            throw std::invalid_argument("Порядок должен содержать каждую вершину ровно один раз");
         }
-        for (const auto& e : edges) {
-            if (e.getFromId() == edge.getFromId() &&
-                e.getToId() == edge.getToId()) {
-                throw std::invalid_argument("Такое ребро уже существует");
+        std::vector<int> newIndex(n, -1);
+        for (int k = 0; k < n; k++) {
+            int old = order[k];
+            if (old < 0 || old >= n || newIndex[old] != -1) {
+                throw std::invalid_argument("Порядок должен содержать каждую вершину ровно один раз");
             }
+            newIndex[old] = k;
+        }
+
+        std::vector<int> ids(n);
+        std::vector<double> weights(n);
+        std::vector<LabelArena::Handle> handles(n);
+        for (int k = 0; k < n; k++) {
+            ids[k] = vertexIds[order[k]];
+            weights[k] = vertexWeights[order[k]];
+            handles[k] = vertexLabels[order[k]];
+            idToIndex.find(ids[k])->second = k;
+        }
+        vertexIds.swap(ids);
+        vertexWeights.swap(weights);
+        vertexLabels.swap(handles);
+        for (size_t e = 0; e < edgeFrom.size(); e++) {
+            edgeFrom[e] = newIndex[edgeFrom[e]];
+            edgeTo[e] = newIndex[edgeTo[e]];
+        }
+
+        // Индексы вершин изменились, поэтому поддерживаемые структуры строятся заново
+        if (bipartiteTracker.isEnabled()) {
+            bipartiteTracker.disable();
+            startBipartiteTracking();
         }
-        edges.push_back(edge);
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Ошибка при добавлении ребра: " << e.what() << std::endl;
+        if (matchingTracker.isEnabled()) {
+            matchingTracker.disable();
+            startMatchingTracking();
+        }
+        invalidateAdjacency();
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в перестановке вершин: ") + e.what());
         throw;
     }
 }
 
+// Перенумерация вершин для локальности обхода (см. VertexOrder)
+// Возвращает применённый порядок: старый индекс вершины, получившей индекс k
+std::vector<int> Graph::reorderVertices(VertexOrder order) {
+    buildAdjacency();
+    std::vector<int> result;
+    computeVertexOrder(order, vertexIds.size(), adjacencyOffsets.data(), adjacencyTargets.data(), result);
+    reorderVertices(result);
+    return result;
+}
+
+// Удаление вершины и всех инцидентных ей рёбер без исключений
+GraphError Graph::tryRemoveVertex(int id) noexcept {
+    int index = indexOf(id);
+    if (index == -1) {
+        return GraphError::VertexNotFound;
+    }
+    vertexIds.erase(vertexIds.begin() + index);
+    vertexWeights.erase(vertexWeights.begin() + index);
+    vertexLabels.erase(vertexLabels.begin() + index);
+
+    // Вершины после удалённой сдвигаются на одну позицию
+    idToIndex.erase(id);
+    for (int i = index; i < static_cast<int>(vertexIds.size()); i++) {
+        idToIndex.find(vertexIds[i])->second = i;
+    }
+
+    // Уплотняем массивы рёбер, сохраняя порядок оставшихся рёбер
+    size_t kept = 0;
+    for (size_t i = 0; i < edgeFrom.size(); i++) {
+        if (edgeFrom[i] == index || edgeTo[i] == index) {
+            continue;
+        }
+        edgeFrom[kept] = edgeFrom[i] > index ? edgeFrom[i] - 1 : edgeFrom[i];
+        edgeTo[kept] = edgeTo[i] > index ? edgeTo[i] - 1 : edgeTo[i];
+        edgeWeights[kept] = edgeWeights[i];
+        edgeDirected[kept] = edgeDirected[i];
+        kept++;
+    }
+    edgeFrom.resize(kept);
+    edgeTo.resize(kept);
+    edgeWeights.resize(kept);
+    edgeDirected.resize(kept);
+
+    // Индексы вершин сдвинулись, поэтому поддерживаемые структуры строятся заново
+    if (bipartiteTracker.isEnabled()) {
+        bipartiteTracker.disable();
+        startBipartiteTracking();
+    }
+    if (matchingTracker.isEnabled()) {
+        matchingTracker.disable();
+        startMatchingTracking();
+    }
+    invalidateAdjacency();
+    return GraphError::None;
+}
+
+// Удаление ребра без исключений
+GraphError Graph::tryRemoveEdge(int fromId, int toId) noexcept {
+    int from = indexOf(fromId);
+    int to = indexOf(toId);
+    if (from == -1 || to == -1) {
+        return GraphError::EdgeNotFound;
+    }
+    size_t index = 0;
+    while (index < edgeFrom.size() &&
+           !(edgeFrom[index] == from && edgeTo[index] == to)) {
+        index++;
+    }
+    if (index == edgeFrom.size()) {
+        return GraphError::EdgeNotFound;
+    }
+    edgeFrom.erase(edgeFrom.begin() + index);
+    edgeTo.erase(edgeTo.begin() + index);
+    edgeWeights.erase(edgeWeights.begin() + index);
+    edgeDirected.erase(edgeDirected.begin() + index);
+    if (bipartiteTracker.isEnabled()) {
+        bipartiteTracker.removeEdge(from, to);
+    }
+    if (matchingTracker.isEnabled()) {
+        matchingTracker.removeEdge(from, to);
+    }
+    invalidateAdjacency();
+    return GraphError::None;
+}
+
+// Поиск вершины без исключений и без вывода сообщений
+Expected<VertexView> Graph::findVertex(int id) noexcept {
+    int index = indexOf(id);
+    if (index == -1) {
+        return GraphError::VertexNotFound;
+    }
+    return VertexView(this, index);
+}
+
+void Graph::addVertex(const Vertex& vertex) {
+    GraphError error = insertVertex(vertex.getId(), vertex.getLabel(), vertex.getWeight());
+    if (error == GraphError::None) {
+        return;
+    }
+
+    std::string message = errorMessage(error);
+    if (error == GraphError::DuplicateVertex) {
+        message = "Вершина с ID " + std::to_string(vertex.getId()) + " уже существует";
+    }
+    logMessage(LogLevel::Error, "Ошибка при добавлении вершины: " + message);
+    throw std::invalid_argument(message);
+}
+
+void Graph::addEdge(const Edge& edge) {
+    GraphError error = insertEdge(edge.getFromId(), edge.getToId(), edge.getWeight(), edge.getIsDirected());
+    if (error == GraphError::None) {
+        return;
+    }
+
+    std::string message = errorMessage(error);
+    if (error == GraphError::SourceNotFound) {
+        message = "Вершина-источник с ID " + std::to_string(edge.getFromId()) + " не найдена";
+    } else if (error == GraphError::TargetNotFound) {
+        message = "Вершина-назначение с ID " + std::to_string(edge.getToId()) + " не найдена";
+    }
+    logMessage(LogLevel::Error, "Ошибка при добавлении ребра: " + message);
+    throw std::invalid_argument(message);
+}
+
 void Graph::removeVertex(int id) {
-    try {
-        auto it = std::find_if(vertices.begin(), vertices.end(),
-            [id](const Vertex& v) { return v.getId() == id; });
-        if (it == vertices.end()) {
-            throw std::invalid_argument(
-                "Вершина с ID " + std::to_string(id) + " не найдена"
-            );
-        }
-        vertices.erase(it);
-
-        edges.erase(
-            std::remove_if(edges.begin(), edges.end(),
-                [id](const Edge& e) {
-                    return e.getFromId() == id || e.getToId() == id;
-                }),
-            edges.end()
-        );
-
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Ошибка при удалении вершины: " << e.what() << std::endl;
-        throw;
+    GraphError error = tryRemoveVertex(id);
+    if (error == GraphError::None) {
+        return;
     }
+
+    std::string message = "Вершина с ID " + std::to_string(id) + " не найдена";
+    logMessage(LogLevel::Error, "Ошибка при удалении вершины: " + message);
+    throw std::invalid_argument(message);
 }
 
 void Graph::removeEdge(int fromId, int toId) {
-    try {
-        auto it = std::find_if(edges.begin(), edges.end(),
-            [fromId, toId](const Edge& e) {
-                return e.getFromId() == fromId && e.getToId() == toId;
-            });
-        if (it == edges.end()) {
-            throw std::invalid_argument(
-                "Ребро от " + std::to_string(fromId) +
-                " к " + std::to_string(toId) + " не найдено"
-            );
-        }
-        edges.erase(it);
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Ошибка при удалении ребра: " << e.what() << std::endl;
-        throw;
+    GraphError error = tryRemoveEdge(fromId, toId);
+    if (error == GraphError::None) {
+        return;
     }
+
+    std::string message = "Ребро от " + std::to_string(fromId) +
+                          " к " + std::to_string(toId) + " не найдено";
+    logMessage(LogLevel::Error, "Ошибка при удалении ребра: " + message);
+    throw std::invalid_argument(message);
 }
 
-Vertex* Graph::getVertex(int id) {
-    try {
-        for (auto& v : vertices) {
-            if (v.getId() == id) {
-                return &v;
-            }
-        }
-        throw std::invalid_argument(
-            "Вершина с ID " + std::to_string(id) + " не найдена"
-        );
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Ошибка при получении вершины: " << e.what() << std::endl;
-        return nullptr;
+VertexView Graph::getVertex(int id) {
+    Expected<VertexView> vertex = findVertex(id);
+    if (!vertex && isLoggingEnabled()) {
+        logMessage(LogLevel::Error, "Ошибка при получении вершины: Вершина с ID " +
+                                    std::to_string(id) + " не найдена");
+    }
+    return vertex.value();
+}
+
+VertexView Graph::vertexAt(int index) {
+    if (index < 0 || index >= static_cast<int>(vertexIds.size())) {
+        throw std::out_of_range("Индекс вершины вне диапазона");
+    }
+    return VertexView(this, index);
+}
+
+EdgeView Graph::edgeAt(int index) const {
+    if (index < 0 || index >= static_cast<int>(edgeFrom.size())) {
+        throw std::out_of_range("Индекс ребра вне диапазона");
     }
+    return EdgeView(this, index);
 }
 
 int Graph::getVertexCount() const {
-    return vertices.size();
+    return vertexIds.size();
 }
 
 int Graph::getEdgeCount() const {
-    return edges.size();
+    return edgeFrom.size();
 }
 
 std::ostream& operator<<(std::ostream& os, const Graph& graph) {
     try {
-        if (graph.vertices.empty()) {
+        if (graph.vertexIds.empty()) {
             if (&os == &std::cout || &os == &std::cerr) {
                 os << "Граф пуст - матрица смежности отсутствует" << std::endl;
             }
             return os;
         }
 
-        std::map<int, int> idToIndex;
-        std::vector<int> indexToId;
-
-        for (const auto& vertex : graph.vertices) {
-            idToIndex[vertex.getId()] = indexToId.size();
-            indexToId.push_back(vertex.getId());
-        }
-
-        int n = graph.vertices.size();
+        const std::vector<int>& indexToId = graph.vertexIds;
+        int n = graph.vertexIds.size();
 
         std::vector<std::vector<double>> adjMatrix(n, std::vector<double>(n, 0.0));
 
-        for (const auto& edge : graph.edges) {
-            int fromIdx = idToIndex[edge.getFromId()];
-            int toIdx = idToIndex[edge.getToId()];
+        for (size_t e = 0; e < graph.edgeFrom.size(); e++) {
+            int fromIdx = graph.edgeFrom[e];
+            int toIdx = graph.edgeTo[e];
+            double weight = graph.edgeWeights[e];
 
-            if (edge.getIsDirected()) {
-                adjMatrix[fromIdx][toIdx] = edge.getWeight();
+            if (graph.edgeDirected[e]) {
+                adjMatrix[fromIdx][toIdx] = weight;
             } else {
-                adjMatrix[fromIdx][toIdx] = edge.getWeight();
-                adjMatrix[toIdx][fromIdx] = edge.getWeight();
+                adjMatrix[fromIdx][toIdx] = weight;
+                adjMatrix[toIdx][fromIdx] = weight;
             }
         }
 
@@ -214,116 +713,191 @@ std::ostream& operator<<(std::ostream& os, const Graph& graph) {
         return os;
 
     } catch (const std::ios_base::failure& e) {
-        std::cerr << "Ошибка ввода/вывода: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка ввода/вывода: ") + e.what());
         throw;
     } catch (const std::exception& e) {
-        std::cerr << "Неожиданная ошибка при выводе матрицы: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Неожиданная ошибка при выводе матрицы: ") + e.what());
         throw;
     }
 }
 
-std::istream& operator>>(std::istream& is, Graph& graph) {
+// Чтение матрицы смежности без исключений
+// Каждая непустая строка - строка матрицы; при ошибке граф не изменяется
+GraphError Graph::tryReadMatrix(std::istream& is) noexcept {
     try {
-        graph.vertices.clear();
-        graph.edges.clear();
-        std::vector<std::vector<double>> matrix;
+        std::vector<double> values;
+        std::vector<int> rowLengths;
         std::string line;
 
         while (std::getline(is, line)) {
-            if (line.empty()) continue;
-
-            std::vector<double> row;
-            std::istringstream iss(line);
-            double value;
-
-            while (iss >> value) {
-                row.push_back(value);
+            std::string_view rest(line);
+            std::string_view token;
+            int length = 0;
+
+            while (nextToken(rest, token)) {
+                double value;
+                if (!parseDouble(token, value)) {
+                    return GraphError::ParseError;
+                }
+                values.push_back(value);
+                length++;
             }
 
-            if (!row.empty()) {
-                matrix.push_back(row);
+            if (length > 0) {
+                rowLengths.push_back(length);
             }
         }
 
-        int n = matrix.size();
-        if (n == 0) {
-            return is;
+        if (is.bad()) {
+            return GraphError::StreamError;
         }
 
-        for (const auto& row : matrix) {
-            if (row.size() != n) {
-                throw std::invalid_argument("Матрица смежности должна быть квадратной");
+        int n = rowLengths.size();
+        for (int length : rowLengths) {
+            if (length != n) {
+                return GraphError::NonSquareMatrix;
             }
         }
 
+        Graph loaded;
+        loaded.idToIndex.reserve(n);
         for (int i = 1; i <= n; i++) {
-            graph.vertices.push_back(Vertex(i, "V" + std::to_string(i), 1.0));
+            loaded.idToIndex[i] = i - 1;
+            loaded.vertexIds.push_back(i);
+            loaded.vertexWeights.push_back(1.0);
+            loaded.vertexLabels.push_back(LabelArena::kDeferred);
         }
 
         for (int i = 0; i < n; i++) {
             for (int j = 0; j < n; j++) {
-                if (matrix[i][j] != 0.0) {
-                    bool isDirected = (matrix[i][j] != matrix[j][i]);
-                    graph.edges.push_back(Edge(i + 1, j + 1, matrix[i][j], isDirected));
+                double value = values[i * n + j];
+                if (value != 0.0) {
+                    // Ненулевой элемент - ребро, поэтому он проверяется как Edge: диагональ
+                    // даёт самопетлю, отрицательные веса и NaN недопустимы
+                    GraphError error = Edge::validate(i + 1, j + 1, value);
+                    if (error != GraphError::None) {
+                        return error;
+                    }
+                    bool isDirected = (value != values[j * n + i]);
+                    loaded.edgeFrom.push_back(i);
+                    loaded.edgeTo.push_back(j);
+                    loaded.edgeWeights.push_back(value);
+                    loaded.edgeDirected.push_back(isDirected ? 1 : 0);
                 }
             }
         }
 
+        *this = std::move(loaded);
+        return GraphError::None;
+
+    } catch (const std::bad_alloc&) {
+        return GraphError::OutOfMemory;
+    } catch (const std::exception&) {
+        return GraphError::StreamError;
+    }
+}
+
+std::istream& operator>>(std::istream& is, Graph& graph) {
+    GraphError error = graph.tryReadMatrix(is);
+    if (error == GraphError::None) {
         return is;
+    }
 
-    } catch (const std::invalid_argument& e) {
-        std::cerr << "Ошибка при вводе матрицы: " << e.what() << std::endl;
-        is.setstate(std::ios_base::failbit);
-        throw;
-    } catch (const std::exception& e) {
-        std::cerr << "Неожиданная ошибка при вводе матрицы: " << e.what() << std::endl;
-        is.setstate(std::ios_base::failbit);
-        throw;
+    graph = Graph();
+    is.setstate(std::ios_base::failbit);
+    logMessage(LogLevel::Error, std::string("Ошибка при вводе матрицы: ") + errorMessage(error));
+    throw std::invalid_argument(errorMessage(error));
+}
+
+// Построение структуры двудольности по текущему графу за O((n + m) α(n))
+// После этого она обновляется при каждом изменении графа
+void Graph::startBipartiteTracking() noexcept {
+    if (bipartiteTracker.isEnabled()) {
+        return;
+    }
+    try {
+        bipartiteTracker.reset(vertexIds.size());
+    } catch (const std::bad_alloc&) {
+        bipartiteTracker.disable();
+        return;
+    }
+    for (size_t e = 0; e < edgeFrom.size() && bipartiteTracker.isEnabled(); e++) {
+        bipartiteTracker.addEdge(edgeFrom[e], edgeTo[e]);
+    }
+}
+
+void Graph::stopBipartiteTracking() noexcept {
+    bipartiteTracker.disable();
+}
+
+// Двудольность без построения разбиения
+// Первый вызов включает отслеживание, последующие отвечают за O(1).
+// Направление рёбер не учитывается
+bool Graph::isBipartite() {
+    startBipartiteTracking();
+    if (bipartiteTracker.isEnabled()) {
+        return bipartiteTracker.isBipartite();
     }
+
+    std::vector<int> partition;
+    return isBipartite(partition);
 }
 
 bool Graph::isBipartite(std::map<int, int>& partition) {
+    AlgorithmWorkspace workspace;
+    std::vector<int> densePartition;
+    bool result = isBipartite(densePartition, workspace);
+
+    partition.clear();
+    for (size_t i = 0; i < densePartition.size(); i++) {
+        partition[vertexIds[i]] = densePartition[i];
+    }
+    return result;
+}
+
+bool Graph::isBipartite(std::vector<int>& partition) {
+    AlgorithmWorkspace workspace;
+    return isBipartite(partition, workspace);
+}
+
+// Проверка двудольности обходом в ширину
+// Доли возвращаются по плотным индексам вершин: partition[i] для вершины idAt(i).
+// Направление рёбер не учитывается: обход по одним исходящим рёбрам давал ответ,
+// зависящий от порядка вершин, и расходился с isBipartite() без разбиения
+bool Graph::isBipartite(std::vector<int>& partition, AlgorithmWorkspace& workspace) {
     try {
-        partition.clear();
-        for (const auto& v : vertices) {
-            partition[v.getId()] = -1;
-        }
+        GRAPH_STAT_TIMER(bipartiteSeconds);
+        int n = vertexIds.size();
+        partition.assign(n, -1);
 
-        if (vertices.empty()) {
-            std::cout << "Граф пуст. Это двудольный граф." << std::endl;
+        if (n == 0) {
+            logMessage(LogLevel::Info, "Граф пуст. Это двудольный граф.");
             return true;
         }
 
+        buildAdjacency();
         bool isBipartiteGraph = true;
+        std::vector<int>& bfsQueue = workspace.cleared(AlgorithmWorkspace::Queue, n);
 
-        for (const auto& startVertex : vertices) {
-            int start = startVertex.getId();
-
+        for (int start = 0; start < n; start++) {
             if (partition[start] != -1) {
                 continue;
             }
 
-            std::queue<int> bfsQueue;
-
             partition[start] = 0;
-
-            bfsQueue.push(start);
-
-            while (!bfsQueue.empty() && isBipartiteGraph) {
-                int currentVertexId = bfsQueue.front();
-                bfsQueue.pop();
-                int currentPartition = partition[currentVertexId];
-                for (const auto& edge : edges) {
-                    if (edge.getFromId() == currentVertexId) {
-                        int neighborId = edge.getToId();
-                        this->processEdge(currentVertexId, neighborId, currentPartition,
-                                         partition, bfsQueue, isBipartiteGraph);
-                    }
-                    else if (!edge.getIsDirected() && edge.getToId() == currentVertexId) {
-                        int neighborId = edge.getFromId();
-                        this->processEdge(currentVertexId, neighborId, currentPartition,
-                                         partition, bfsQueue, isBipartiteGraph);
-                    }
+            GRAPH_STAT_ADD(bfsPhases, 1);
+
+            bfsQueue.clear();
+            bfsQueue.push_back(start);
+            size_t head = 0;
+
+            while (head < bfsQueue.size() && isBipartiteGraph) {
+                int current = bfsQueue[head++];
+                int currentPartition = partition[current];
+                GRAPH_STAT_ADD(edgesScanned, adjacencyOffsets[current + 1] - adjacencyOffsets[current]);
+                for (int k = adjacencyOffsets[current]; k < adjacencyOffsets[current + 1]; k++) {
+                    this->processEdge(current, adjacencyTargets[k], currentPartition,
+                                     partition, bfsQueue, isBipartiteGraph);
                 }
             }
             if (!isBipartiteGraph) {
@@ -334,24 +908,28 @@ bool Graph::isBipartite(std::map<int, int>& partition) {
         return isBipartiteGraph;
 
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка при проверке двудольности: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка при проверке двудольности: ") + e.what());
         throw;
     }
 }
 
-void Graph::processEdge(int fromId, int toId, int fromPartition,
-                        std::map<int, int>& partition,
-                        std::queue<int>& bfsQueue,
+void Graph::processEdge(int from, int to, int fromPartition,
+                        std::vector<int>& partition,
+                        std::vector<int>& bfsQueue,
                         bool& isBipartiteGraph) {
-    if (partition[toId] == -1) {
-        partition[toId] = !fromPartition;
-        bfsQueue.push(toId);
+    if (partition[to] == -1) {
+        partition[to] = !fromPartition;
+        bfsQueue.push_back(to);
     }
     else {
-        if (partition[toId] == partition[fromId]) {
-            std::cerr << "Обнаружено ребро между вершинами одной доли: "
-                      << fromId << " (доля " << partition[fromId] << ") и "
-                      << toId << " (доля " << partition[toId] << ")" << std::endl;
+        if (partition[to] == partition[from]) {
+            if (isLoggingEnabled()) {
+                std::ostringstream message;
+                message << "Обнаружено ребро между вершинами одной доли: "
+                        << vertexIds[from] << " (доля " << partition[from] << ") и "
+                        << vertexIds[to] << " (доля " << partition[to] << ")";
+                logMessage(LogLevel::Error, message.str());
+            }
             isBipartiteGraph = false;
         }
     }
@@ -384,85 +962,173 @@ void Graph::printBipartiteInfo(const std::map<int, int>& partition) const {
         std::cout << std::endl;
 
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка при выводе информации о двудольности: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка при выводе информации о двудольности: ") + e.what());
         throw;
     }
 }
 
-bool Graph::dfsHelper(int vertexId, int color, std::map<int, int>& partition) {
+// Обход в глубину с явным стеком вместо рекурсии,
+// чтобы длинные пути не переполняли стек вызовов. Направление рёбер не учитывается.
+// В стеке лежат пары (вершина, позиция следующей записи смежности)
+bool Graph::dfsHelper(int start, int color, std::vector<int>& partition, std::vector<int>& stack) {
     try {
-        partition[vertexId] = color;
-
-        for (const auto& edge : edges) {
-            int neighborId = -1;
-            bool isNeighbor = false;
-
-            if (edge.getFromId() == vertexId) {
-                neighborId = edge.getToId();
-                isNeighbor = true;
-            }
-            else if (!edge.getIsDirected() && edge.getToId() == vertexId) {
-                neighborId = edge.getFromId();
-                isNeighbor = true;
+        stack.clear();
+        partition[start] = color;
+        stack.push_back(start);
+        stack.push_back(adjacencyOffsets[start]);
+
+        while (!stack.empty()) {
+            int vertex = stack[stack.size() - 2];
+            int k = stack.back();
+
+            if (k == adjacencyOffsets[vertex + 1]) {
+                stack.pop_back();
+                stack.pop_back();
+                continue;
             }
-
-            if (isNeighbor) {
-                if (partition[neighborId] == -1) {
-                    int nextColor = 1 - color;
-                    if (!dfsHelper(neighborId, nextColor, partition)) {
-                        return false;
-                    }
-                } else {
-                    if (partition[neighborId] == partition[vertexId]) {
-                        std::cerr << "Обнаружено ребро между вершинами одного цвета: "
-                                  << vertexId << " (цвет " << partition[vertexId] << ") и "
-                                  << neighborId << " (цвет " << partition[neighborId] << ")" << std::endl;
-                        return false;
+            stack.back()++;
+            GRAPH_STAT_ADD(edgesScanned, 1);
+
+            int neighbor = adjacencyTargets[k];
+            if (partition[neighbor] == -1) {
+                partition[neighbor] = 1 - partition[vertex];
+                stack.push_back(neighbor);
+                stack.push_back(adjacencyOffsets[neighbor]);
+            } else {
+                if (partition[neighbor] == partition[vertex]) {
+                    if (isLoggingEnabled()) {
+                        std::ostringstream message;
+                        message << "Обнаружено ребро между вершинами одного цвета: "
+                                << vertexIds[vertex] << " (цвет " << partition[vertex] << ") и "
+                                << vertexIds[neighbor] << " (цвет " << partition[neighbor] << ")";
+                        logMessage(LogLevel::Error, message.str());
                     }
+                    return false;
                 }
             }
         }
         return true;
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка в DFS: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка в DFS: ") + e.what());
         throw;
     }
 }
 
 bool Graph::isBipartiteDFS(std::map<int, int>& partition) {
-    try {
-        partition.clear();
+    AlgorithmWorkspace workspace;
+    std::vector<int> densePartition;
+    bool result = isBipartiteDFS(densePartition, workspace);
 
-        for (const auto& v : vertices) {
-            partition[v.getId()] = -1;
-        }
+    partition.clear();
+    for (size_t i = 0; i < densePartition.size(); i++) {
+        partition[vertexIds[i]] = densePartition[i];
+    }
+    return result;
+}
+
+bool Graph::isBipartiteDFS(std::vector<int>& partition) {
+    AlgorithmWorkspace workspace;
+    return isBipartiteDFS(partition, workspace);
+}
+
+bool Graph::isBipartiteDFS(std::vector<int>& partition, AlgorithmWorkspace& workspace) {
+    try {
+        GRAPH_STAT_TIMER(bipartiteSeconds);
+        int n = vertexIds.size();
+        partition.assign(n, -1);
 
 
-        if (vertices.empty()) {
-            std::cout << "Граф пуст. Это двудольный граф." << std::endl;
+        if (n == 0) {
+            logMessage(LogLevel::Info, "Граф пуст. Это двудольный граф.");
             return true;
         }
 
-        for (const auto& startVertex : vertices) {
-            int startId = startVertex.getId();
+        buildAdjacency();
+        std::vector<int>& stack = workspace.cleared(AlgorithmWorkspace::Stack, 2 * n);
 
-            if (partition[startId] != -1) {
+        for (int start = 0; start < n; start++) {
+            if (partition[start] != -1) {
                 continue;
             }
 
-            std::cout << "Запуск DFS из вершины " << startId << std::endl;
+            if (isLoggingEnabled()) {
+                logMessage(LogLevel::Info, "Запуск DFS из вершины " + std::to_string(vertexIds[start]));
+            }
 
-            if (!dfsHelper(startId, 0, partition)) {
-                std::cout << "Граф НЕ двудольный" << std::endl;
+            if (!dfsHelper(start, 0, partition, stack)) {
+                logMessage(LogLevel::Info, "Граф НЕ двудольный");
                 return false;
             }
         }
 
-        std::cout << "Граф успешно окрашен в два цвета" << std::endl;
+        logMessage(LogLevel::Info, "Граф успешно окрашен в два цвета");
         return true;
 
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка при проверке двудольности (DFS): " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка при проверке двудольности (DFS): ") + e.what());
+        throw;
+    }
+}
+
+// Нечётный цикл - свидетель того, что граф не двудольный (направления рёбер не учитываются)
+// Поиск в ширину с родителями: ребро между вершинами одной чётности глубины замыкает
+// цикл через их общего предка. В cycle - ID вершин цикла по порядку, последняя соединена
+// с первой. Возвращает false и пустой cycle, если граф двудольный
+bool Graph::findOddCycle(std::vector<int>& cycle) {
+    try {
+        GRAPH_STAT_TIMER(bipartiteSeconds);
+        int n = vertexIds.size();
+        cycle.clear();
+        buildAdjacency();
+
+        std::vector<int> depth(n, -1);
+        std::vector<int> parent(n, -1);
+        std::vector<int> bfsQueue;
+        bfsQueue.reserve(n);
+
+        for (int start = 0; start < n; start++) {
+            if (depth[start] != -1) {
+                continue;
+            }
+            GRAPH_STAT_ADD(bfsPhases, 1);
+            depth[start] = 0;
+            bfsQueue.clear();
+            bfsQueue.push_back(start);
+
+            for (std::size_t head = 0; head < bfsQueue.size(); head++) {
+                int current = bfsQueue[head];
+                GRAPH_STAT_ADD(edgesScanned, adjacencyOffsets[current + 1] - adjacencyOffsets[current]);
+                for (int k = adjacencyOffsets[current]; k < adjacencyOffsets[current + 1]; k++) {
+                    int neighbor = adjacencyTargets[k];
+                    if (depth[neighbor] == -1) {
+                        depth[neighbor] = depth[current] + 1;
+                        parent[neighbor] = current;
+                        bfsQueue.push_back(neighbor);
+                    } else if ((depth[neighbor] - depth[current]) % 2 == 0) {
+                        // Путь current -> предок -> neighbor; глубины равны, поэтому длина нечётна
+                        std::vector<int> tail;
+                        int a = current;
+                        int b = neighbor;
+                        while (a != b) {
+                            if (depth[a] >= depth[b]) {
+                                cycle.push_back(vertexIds[a]);
+                                a = parent[a];
+                            } else {
+                                tail.push_back(vertexIds[b]);
+                                b = parent[b];
+                            }
+                        }
+                        cycle.push_back(vertexIds[a]);
+                        cycle.insert(cycle.end(), tail.rbegin(), tail.rend());
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка при поиске нечётного цикла: ") + e.what());
         throw;
     }
 }
@@ -471,147 +1137,723 @@ std::pair<double, std::vector<std::pair<int, int>>> Graph::solveAssignmentProble
     const std::vector<int>& firstPart,
     const std::vector<int>& secondPart) {
 
-    try {
-        const double INF = 1e9;
-        int n = firstPart.size();
+    AlgorithmWorkspace workspace;
+    std::vector<std::pair<int, int>> matching;
+    double totalCost = solveAssignmentProblem(firstPart, secondPart, matching, workspace);
+    return {totalCost, matching};
+}
 
-        if (n != secondPart.size()) {
+double Graph::solveAssignmentProblem(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    std::vector<std::pair<int, int>>& matching,
+    AlgorithmWorkspace& workspace) {
+
+    SolveStatus status;
+    return solveAssignmentProblem(firstPart, secondPart, matching, workspace, SolveOptions(), status);
+}
+
+// Назначение вместе с двойственными переменными: workerPotentials[i] для firstPart[i],
+// taskPotentials[j] для secondPart[j]. Сумма потенциалов равна стоимости, что вместе
+// с допустимостью даёт сертификат оптимальности (см. verifyAssignment)
+double Graph::solveAssignmentProblem(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    std::vector<std::pair<int, int>>& matching,
+    std::vector<double>& workerPotentials,
+    std::vector<double>& taskPotentials) {
+
+    AlgorithmWorkspace workspace;
+    double totalCost = solveAssignmentProblem(firstPart, secondPart, matching, workspace);
+    const std::vector<double>& u = workspace.doubles(AlgorithmWorkspace::PotentialU);
+    const std::vector<double>& v = workspace.doubles(AlgorithmWorkspace::PotentialV);
+    workerPotentials.assign(u.begin() + std::min<std::size_t>(1, u.size()), u.end());
+    taskPotentials.assign(v.begin() + std::min<std::size_t>(1, v.size()), v.end());
+    return totalCost;
+}
+
+// Венгерский алгоритм (потенциалы u, v и кратчайшие увеличивающие пути)
+// Назначение записывается в matching, возвращается минимальная стоимость.
+// Фаза - добавление одного работника; при отмене или истечении срока возвращается
+// оптимальное назначение уже добавленных работников и его стоимость, status.complete == false.
+// Двойственные переменные работников и задач (с 1) остаются в буферах
+// workspace.doubles(PotentialU) и workspace.doubles(PotentialV) при любом ядре
+double Graph::solveAssignmentProblem(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    std::vector<std::pair<int, int>>& matching,
+    AlgorithmWorkspace& workspace,
+    const SolveOptions& options,
+    SolveStatus& status) {
+
+    try {
+        const double INF = 1e9;
+        int n = firstPart.size();
+        matching.clear();
+        status = SolveStatus();
+
+        if (n != static_cast<int>(secondPart.size())) {
             throw std::invalid_argument("Размеры долей должны быть одинаковыми");
         }
 
         if (n == 0) {
-            return {0.0, {}};
+            return 0.0;
         }
 
-        std::vector<std::vector<double>> cost(n, std::vector<double>(n, INF));
+        // Столбец каждой вершины второй доли; повторы связаны в цепочку через nextColumn
+        buildAdjacency();
+        std::vector<int>& firstColumn = workspace.ints(AlgorithmWorkspace::ColumnHead, vertexIds.size(), -1);
+        std::vector<int>& nextColumn = workspace.ints(AlgorithmWorkspace::ColumnNext, n, -1);
+        for (int j = n - 1; j >= 0; j--) {
+            int index = indexOf(secondPart[j]);
+            if (index != -1) {
+                nextColumn[j] = firstColumn[index];
+                firstColumn[index] = j;
+            }
+        }
 
-        for (int i = 0; i < n; i++) {
-            for (int j = 0; j < n; j++) {
-                int fromId = firstPart[i];
-                int toId = secondPart[j];
-
-                for (const auto& edge : edges) {
-                    if ((edge.getFromId() == fromId && edge.getToId() == toId) ||
-                        (!edge.getIsDirected() && edge.getFromId() == toId && edge.getToId() == fromId)) {
-                        cost[i][j] = edge.getWeight();
-                        break;
+        // Обход стоимостей пар: visit(i, j, вес). Стоимость пары берётся из первого
+        // по порядку ребра из работника в задачу, поэтому исходящие записи идут с конца
+        auto forEachPair = [&](auto visit) {
+            for (int i = 0; i < n; i++) {
+                int from = indexOf(firstPart[i]);
+                if (from == -1) {
+                    continue;
+                }
+                GRAPH_STAT_ADD(edgesScanned, adjacencyOffsets[from + 1] - adjacencyOffsets[from]);
+                for (int k = adjacencyOffsets[from + 1] - 1; k >= adjacencyOffsets[from]; k--) {
+                    if (!adjacencyOutgoing[k]) {
+                        continue;
+                    }
+                    for (int j = firstColumn[adjacencyTargets[k]]; j != -1; j = nextColumn[j]) {
+                        visit(i, j, edgeWeights[adjacencyEdges[k]]);
                     }
                 }
             }
+        };
+
+        // Целые веса решаются точно в int64_t, если потенциалы заведомо не переполнятся
+        const double maxExactInteger = 9007199254740992.0;  // 2^53
+        bool integral = true;
+        double maxAbsWeight = 0.0;
+        std::size_t pairCount = 0;
+        {
+            GRAPH_STAT_TIMER(assignmentBuildSeconds);
+            forEachPair([&](int, int, double weight) {
+                if (weight != std::floor(weight) || std::fabs(weight) > maxExactInteger) {
+                    integral = false;
+                }
+                maxAbsWeight = std::max(maxAbsWeight, std::fabs(weight));
+                pairCount++;
+            });
         }
+        integral = integral && integerCostsFit(static_cast<std::int64_t>(maxAbsWeight), n);
 
-        std::vector<double> u(n+1, 0), v(n+1, 0);
-        std::vector<int> p(n+1, 0), way(n+1, 0);
+        // Большие разреженные задачи решаются сетевым симплекс-методом без матрицы n x n
+        if (n >= kSparseAssignmentMinSize && !options.hasLimits() &&
+            pairCount * kSparseAssignmentDensity <= static_cast<std::size_t>(n) * n) {
+            return solveSparseAssignment(firstPart, secondPart, matching, workspace, status);
+        }
 
-        for (int i = 1; i <= n; i++) {
-            p[0] = i;
-            int j0 = 0;
-            std::vector<double> minv(n+1, INF);
-            std::vector<bool> used(n+1, false);
-
-            do {
-                used[j0] = true;
-                int i0 = p[j0];
-                double delta = INF;
-                int j1 = 0;
-
-                for (int j = 1; j <= n; j++) {
-                    if (!used[j]) {
-                        double cur = cost[i0-1][j-1] - u[i0] - v[j];
-                        if (cur < minv[j]) {
-                            minv[j] = cur;
-                            way[j] = j0;
-                        }
-                        if (minv[j] < delta) {
-                            delta = minv[j];
-                            j1 = j;
-                        }
+        const std::vector<int>& p = workspace.ints(AlgorithmWorkspace::Assignment);
+
+        if (integral) {
+            std::vector<std::int64_t>& cost = workspace.longs(AlgorithmWorkspace::IntegerCost, n * n, kNoPair);
+            {
+                GRAPH_STAT_TIMER(assignmentBuildSeconds);
+                forEachPair([&](int i, int j, double weight) {
+                    cost[i * n + j] = static_cast<std::int64_t>(weight);
+                });
+            }
+
+            std::int64_t total = 0;
+            std::int64_t maxAbsCost = static_cast<std::int64_t>(maxAbsWeight);
+            if (n <= kSmallAssignmentMax && !options.hasLimits() &&
+                maxAbsCost < std::numeric_limits<std::int64_t>::max() / (8 * (n + 1) * (n + 1))) {
+                // Малые задачи решаются точными ядрами фиксированного размера. Отсутствующая
+                // пара стоит дороже любого назначения из настоящих пар, поэтому попадает
+                // в ответ, только если совершенного назначения нет
+                std::int64_t missing = 2 * (n + 1) * (maxAbsCost + 1);
+                std::replace(cost.begin(), cost.end(), kNoPair, missing);
+                std::vector<int>& rowColumn = workspace.ints(AlgorithmWorkspace::Way, n, 0);
+                std::vector<std::int64_t>& rowPotential = workspace.longs(AlgorithmWorkspace::IntegerPotentialU, n + 1, 0);
+                std::vector<std::int64_t>& columnPotential = workspace.longs(AlgorithmWorkspace::IntegerPotentialV, n + 1, 0);
+                solveSmallAssignment(n, cost.data(), rowColumn.data(), total, rowPotential.data() + 1, columnPotential.data() + 1);
+                std::vector<int>& columnRow = workspace.ints(AlgorithmWorkspace::Assignment, n + 1, 0);
+                for (int i = 0; i < n; i++) {
+                    if (cost[i * n + rowColumn[i]] == missing) {
+                        throw std::runtime_error("Не удалось найти совершенное паросочетание: возможно, граф не полный");
                     }
+                    columnRow[rowColumn[i] + 1] = i + 1;
                 }
+                status.phasesDone = status.phasesTotal = n;
+            } else if (!runHungarianInteger(cost.data(), n, workspace, options, status, total)) {
+                throw std::runtime_error("Не удалось найти совершенное паросочетание: возможно, граф не полный");
+            }
+            const std::vector<std::int64_t>& integerU = workspace.longs(AlgorithmWorkspace::IntegerPotentialU);
+            const std::vector<std::int64_t>& integerV = workspace.longs(AlgorithmWorkspace::IntegerPotentialV);
+            std::vector<double>& u = workspace.doubles(AlgorithmWorkspace::PotentialU, n + 1, 0.0);
+            std::vector<double>& v = workspace.doubles(AlgorithmWorkspace::PotentialV, n + 1, 0.0);
+            for (int k = 0; k <= n; k++) {
+                u[k] = static_cast<double>(integerU[k]);
+                v[k] = static_cast<double>(integerV[k]);
+            }
 
-                for (int j = 0; j <= n; j++) {
-                    if (used[j]) {
-                        u[p[j]] += delta;
-                        v[j] -= delta;
-                    } else {
-                        minv[j] -= delta;
-                    }
+            if (static_cast<int>(matching.capacity()) < n) {
+                matching.reserve(n);
+            }
+            for (int j = 1; j <= n; j++) {
+                if (p[j] != 0) {
+                    matching.push_back({firstPart[p[j]-1], secondPart[j-1]});
                 }
+            }
+            return static_cast<double>(total);
+        }
 
-                j0 = j1;
-            } while (p[j0] != 0);
+        // Матрица стоимостей хранится построчно в одном буфере: cost[i * n + j]
+        std::vector<double>& cost = workspace.doubles(AlgorithmWorkspace::Cost, n * n, INF);
+        {
+            GRAPH_STAT_TIMER(assignmentBuildSeconds);
+            forEachPair([&](int i, int j, double weight) {
+                cost[i * n + j] = weight;
+            });
+        }
 
-            do {
-                int j1 = way[j0];
-                p[j0] = p[j1];
-                j0 = j1;
-            } while (j0);
+        double totalCost = 0.0;
+        if (n <= kSmallAssignmentMax && !options.hasLimits()) {
+            // Малые задачи решаются ядрами с размером, известным при компиляции
+            std::vector<int>& rowColumn = workspace.ints(AlgorithmWorkspace::Way, n, 0);
+            std::vector<double>& u = workspace.doubles(AlgorithmWorkspace::PotentialU, n + 1, 0.0);
+            std::vector<double>& v = workspace.doubles(AlgorithmWorkspace::PotentialV, n + 1, 0.0);
+            solveSmallAssignment(n, cost.data(), rowColumn.data(), totalCost, u.data() + 1, v.data() + 1);
+            std::vector<int>& columnRow = workspace.ints(AlgorithmWorkspace::Assignment, n + 1, 0);
+            for (int i = 0; i < n; i++) {
+                columnRow[rowColumn[i] + 1] = i + 1;
+            }
+            status.phasesDone = status.phasesTotal = n;
+        } else {
+            totalCost = runHungarian(cost.data(), n, workspace, options, status);
         }
 
-        double totalCost = -v[0];
-        std::vector<std::pair<int, int>> matching;
+        if (!status.complete) {
+            // Частичное назначение: пары без рёбер (стоимость INF) не возвращаются
+            double partialCost = 0.0;
+            for (int j = 1; j <= n; j++) {
+                if (p[j] != 0 && cost[(p[j] - 1) * n + (j - 1)] < INF) {
+                    partialCost += cost[(p[j] - 1) * n + (j - 1)];
+                    matching.push_back({firstPart[p[j]-1], secondPart[j-1]});
+                }
+            }
+            return partialCost;
+        }
 
+        if (totalCost > INF / 2) {
+            throw std::runtime_error("Не удалось найти совершенное паросочетание: возможно, граф не полный");
+        }
+
+        if (static_cast<int>(matching.capacity()) < n) {
+            matching.reserve(n);
+        }
         for (int j = 1; j <= n; j++) {
             if (p[j] != 0) {
                 matching.push_back({firstPart[p[j]-1], secondPart[j-1]});
             }
         }
 
-        if (totalCost > INF / 2) {
+        return totalCost;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в Венгерском алгоритме: ") + e.what());
+        throw;
+    }
+}
+
+// Задача о назначениях как поток минимальной стоимости: работники отдают по единице,
+// задачи принимают по единице, пары - дуги без ограничения пропускной способности.
+// Без верхних границ все дуги вне базиса пусты, поэтому потенциалы узлов дают
+// двойственные переменные назначения (u = -potential работника, v = potential задачи);
+// назначение и они записываются в те же буферы, что у венгерского алгоритма
+double Graph::solveSparseAssignment(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    std::vector<std::pair<int, int>>& matching,
+    AlgorithmWorkspace& workspace,
+    SolveStatus& status) {
+
+    int n = firstPart.size();
+    std::vector<int> rows;
+    std::vector<int> columns;
+    std::vector<double> weights;
+    collectAssignmentPairs(firstPart, secondPart, rows, columns, weights);
+    for (int& column : columns) {
+        column += n;
+    }
+    std::vector<std::int64_t> capacity(rows.size(), kInfiniteCapacity);
+    std::vector<std::int64_t> supply(2 * n, 1);
+    std::fill(supply.begin() + n, supply.end(), -1);
+
+    MinCostFlowSolver solver;
+    solver.setNetwork(2 * n, rows.data(), columns.data(), capacity.data(), rows.size(), supply.data());
+    if (solver.solve(weights.data()) != FlowResult::Optimal) {
+        throw std::runtime_error("Не удалось найти совершенное паросочетание: возможно, граф не полный");
+    }
+
+    std::vector<int>& p = workspace.ints(AlgorithmWorkspace::Assignment, n + 1, 0);
+    for (std::size_t k = 0; k < rows.size(); k++) {
+        if (solver.getFlow(k) > 0) {
+            p[columns[k] - n + 1] = rows[k] + 1;
+        }
+    }
+    std::vector<double>& u = workspace.doubles(AlgorithmWorkspace::PotentialU, n + 1, 0.0);
+    std::vector<double>& v = workspace.doubles(AlgorithmWorkspace::PotentialV, n + 1, 0.0);
+    for (int i = 0; i < n; i++) {
+        u[i + 1] = -solver.getPotential(i);
+        v[i + 1] = solver.getPotential(n + i);
+    }
+
+    matching.reserve(n);
+    for (int j = 1; j <= n; j++) {
+        matching.push_back({firstPart[p[j] - 1], secondPart[j - 1]});
+    }
+    status.phasesDone = status.phasesTotal = n;
+    return solver.getTotalCost();
+}
+
+std::pair<double, std::vector<std::int64_t>> Graph::solveMinCostFlow(
+    const std::vector<std::int64_t>& supply,
+    const std::vector<std::int64_t>& capacity) {
+
+    MinCostFlowSolver solver;
+    std::vector<std::int64_t> flow;
+    double totalCost = solveMinCostFlow(supply, capacity, flow, solver);
+    return {totalCost, flow};
+}
+
+// Поток минимальной стоимости по рёбрам графа: стоимость единицы потока - вес ребра,
+// capacity[e] - пропускная способность ребра e (как в edgeAt), supply[v] - баланс вершины
+// с плотным индексом v (> 0 - отдаёт поток, < 0 - принимает). Неориентированное ребро
+// пропускает поток в обе стороны. В flow[e] - поток по ребру, отрицательный - от to к from.
+// Возвращается стоимость потока
+double Graph::solveMinCostFlow(
+    const std::vector<std::int64_t>& supply,
+    const std::vector<std::int64_t>& capacity,
+    std::vector<std::int64_t>& flow,
+    MinCostFlowSolver& solver) {
+
+    try {
+        int n = vertexIds.size();
+        int m = edgeFrom.size();
+        if (static_cast<int>(supply.size()) != n || static_cast<int>(capacity.size()) != m) {
+            throw std::invalid_argument("Размеры балансов и пропускных способностей не совпадают с графом");
+        }
+
+        // Дуга на каждое ребро и обратная на каждое неориентированное
+        std::vector<int> from(edgeFrom);
+        std::vector<int> to(edgeTo);
+        std::vector<std::int64_t> arcCapacity(capacity);
+        std::vector<double> cost(edgeWeights);
+        std::vector<int> reverseArc(m, -1);
+        for (int e = 0; e < m; e++) {
+            if (capacity[e] < 0) {
+                throw std::invalid_argument("Пропускная способность ребра не может быть отрицательной");
+            }
+            if (!edgeDirected[e]) {
+                reverseArc[e] = from.size();
+                from.push_back(edgeTo[e]);
+                to.push_back(edgeFrom[e]);
+                arcCapacity.push_back(capacity[e]);
+                cost.push_back(edgeWeights[e]);
+            }
+        }
+
+        solver.setNetwork(n, from.data(), to.data(), arcCapacity.data(), from.size(), supply.data());
+        FlowResult result = solver.solve(cost.data());
+        if (result == FlowResult::Infeasible) {
+            throw std::runtime_error("Балансы вершин нельзя удовлетворить при заданных пропускных способностях");
+        }
+        if (result == FlowResult::Unbounded) {
+            throw std::runtime_error("Стоимость потока не ограничена снизу");
+        }
+
+        flow.assign(m, 0);
+        for (int e = 0; e < m; e++) {
+            flow[e] = solver.getFlow(e);
+            if (reverseArc[e] != -1) {
+                flow[e] -= solver.getFlow(reverseArc[e]);
+            }
+        }
+        return solver.getTotalCost();
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в задаче о потоке минимальной стоимости: ") + e.what());
+        throw;
+    }
+}
+
+// Пары (работник i, задача j) разреженной задачи о назначениях по индексам в долях
+// Пара - исходящее ребро работника в задачу; из кратных рёбер берётся первое, как в
+// solveAssignmentProblem. Повторы вершины во второй доле дают по паре на каждый столбец
+void Graph::collectAssignmentPairs(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    std::vector<int>& rows,
+    std::vector<int>& columns,
+    std::vector<double>& weights) const {
+
+    GRAPH_STAT_TIMER(assignmentBuildSeconds);
+    int n = secondPart.size();
+    buildAdjacency();
+    std::vector<int> firstColumn(vertexIds.size(), -1);
+    std::vector<int> nextColumn(n, -1);
+    for (int j = n - 1; j >= 0; j--) {
+        int index = indexOf(secondPart[j]);
+        if (index != -1) {
+            nextColumn[j] = firstColumn[index];
+            firstColumn[index] = j;
+        }
+    }
+
+    // seen[j] == i, если пара (i, j) уже добавлена
+    std::vector<int> seen(n, -1);
+    rows.clear();
+    columns.clear();
+    weights.clear();
+    for (int i = 0; i < static_cast<int>(firstPart.size()); i++) {
+        int from = indexOf(firstPart[i]);
+        if (from == -1) {
+            continue;
+        }
+        GRAPH_STAT_ADD(edgesScanned, adjacencyOffsets[from + 1] - adjacencyOffsets[from]);
+        for (int k = adjacencyOffsets[from]; k < adjacencyOffsets[from + 1]; k++) {
+            if (!adjacencyOutgoing[k]) {
+                continue;
+            }
+            for (int j = firstColumn[adjacencyTargets[k]]; j != -1; j = nextColumn[j]) {
+                if (seen[j] == i) {
+                    continue;
+                }
+                seen[j] = i;
+                rows.push_back(i);
+                columns.push_back(j);
+                weights.push_back(edgeWeights[adjacencyEdges[k]]);
+            }
+        }
+    }
+}
+
+std::pair<double, std::vector<std::pair<int, int>>> Graph::solveBottleneckAssignment(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart) {
+
+    BottleneckAssignmentSolver solver;
+    std::vector<std::pair<int, int>> matching;
+    double bottleneck = solveBottleneckAssignment(firstPart, secondPart, matching, solver);
+    return {bottleneck, matching};
+}
+
+// Задача о назначениях на узкое место: совершенное назначение с минимальным наибольшим весом
+// Пары и их веса берутся так же, как в solveAssignmentProblem.
+// Возвращается вес самого тяжёлого ребра назначения
+double Graph::solveBottleneckAssignment(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    std::vector<std::pair<int, int>>& matching,
+    BottleneckAssignmentSolver& solver) {
+
+    try {
+        int n = firstPart.size();
+        matching.clear();
+
+        if (n != static_cast<int>(secondPart.size())) {
+            throw std::invalid_argument("Размеры долей должны быть одинаковыми");
+        }
+
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<double> weights;
+        collectAssignmentPairs(firstPart, secondPart, rows, columns, weights);
+
+        std::vector<int> assignment(n);
+        double bottleneck;
+        if (!solver.solve(n, rows.data(), columns.data(), weights.data(), rows.size(), assignment.data(), bottleneck)) {
             throw std::runtime_error("Не удалось найти совершенное паросочетание: возможно, граф не полный");
         }
 
-        return {totalCost, matching};
+        matching.reserve(n);
+        for (int i = 0; i < n; i++) {
+            matching.push_back({firstPart[i], secondPart[assignment[i]]});
+        }
+        return bottleneck;
 
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка в Венгерском алгоритме: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка в задаче о назначениях на узкое место: ") + e.what());
         throw;
     }
 }
 
-std::vector<std::pair<int, int>> Graph::findMaximumMatching() {
+// Ёмкости вершин доли для задач с ёмкостями - веса вершин (целые неотрицательные)
+// Вершина, отсутствующая в графе, получает ёмкость 0
+void Graph::collectCapacities(const std::vector<int>& part, std::vector<int>& capacity) const {
+    capacity.assign(part.size(), 0);
+    for (std::size_t i = 0; i < part.size(); i++) {
+        int index = indexOf(part[i]);
+        if (index == -1) {
+            continue;
+        }
+        double weight = vertexWeights[index];
+        if (weight < 0.0 || weight != std::floor(weight) || weight > std::numeric_limits<int>::max()) {
+            throw std::invalid_argument("Ёмкость вершины " + std::to_string(part[i]) +
+                                        " (её вес) должна быть целым неотрицательным числом");
+        }
+        capacity[i] = static_cast<int>(weight);
+    }
+}
+
+std::pair<double, std::vector<std::pair<int, int>>> Graph::solveCapacitatedAssignment(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart) {
+
+    CapacitatedAssignmentSolver solver;
+    std::vector<std::pair<int, int>> matching;
+    double totalCost = solveCapacitatedAssignment(firstPart, secondPart, matching, solver);
+    return {totalCost, matching};
+}
+
+// Задача о назначениях с ёмкостями: вершина firstPart[i] берёт до weight(firstPart[i]) задач,
+// вершина secondPart[j] принимает до weight(secondPart[j]) работников, каждая пара - не
+// больше одного раза. Пары и их веса берутся так же, как в solveAssignmentProblem, доли
+// могут быть разного размера. В matching - назначение наибольшего размера и наименьшей
+// среди таких стоимости, она и возвращается
+double Graph::solveCapacitatedAssignment(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    std::vector<std::pair<int, int>>& matching,
+    CapacitatedAssignmentSolver& solver) {
+
     try {
-        for (const auto& edge : edges) {
-            if (edge.getIsDirected()) {
-                throw std::invalid_argument("Алгоритм Эдмондса работает только с неориентированными графами");
+        matching.clear();
+        std::vector<int> rowCapacity;
+        std::vector<int> columnCapacity;
+        collectCapacities(firstPart, rowCapacity);
+        collectCapacities(secondPart, columnCapacity);
+
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<double> weights;
+        collectAssignmentPairs(firstPart, secondPart, rows, columns, weights);
+
+        std::vector<unsigned char> used(rows.size());
+        int assignedCount;
+        double totalCost = solver.solve(firstPart.size(), rowCapacity.data(), secondPart.size(), columnCapacity.data(),
+                                        rows.data(), columns.data(), weights.data(), rows.size(),
+                                        used.data(), assignedCount);
+
+        matching.reserve(assignedCount);
+        for (std::size_t k = 0; k < rows.size(); k++) {
+            if (used[k]) {
+                matching.push_back({firstPart[rows[k]], secondPart[columns[k]]});
             }
         }
+        return totalCost;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в задаче о назначениях с ёмкостями: ") + e.what());
+        throw;
+    }
+}
+
+// Наибольшее b-паросочетание между долями с ёмкостями из весов вершин
+// Единичные стоимости пар превращают фазы в поиск кратчайших по числу рёбер
+// увеличивающих путей, как в алгоритме Хопкрофта-Карпа
+std::vector<std::pair<int, int>> Graph::findMaximumBMatching(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart) {
+
+    try {
+        std::vector<int> rowCapacity;
+        std::vector<int> columnCapacity;
+        collectCapacities(firstPart, rowCapacity);
+        collectCapacities(secondPart, columnCapacity);
+
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<double> weights;
+        collectAssignmentPairs(firstPart, secondPart, rows, columns, weights);
+        std::fill(weights.begin(), weights.end(), 1.0);
+
+        CapacitatedAssignmentSolver solver;
+        std::vector<unsigned char> used(rows.size());
+        int assignedCount;
+        solver.solve(firstPart.size(), rowCapacity.data(), secondPart.size(), columnCapacity.data(),
+                     rows.data(), columns.data(), weights.data(), rows.size(), used.data(), assignedCount);
+
+        std::vector<std::pair<int, int>> matching;
+        matching.reserve(assignedCount);
+        for (std::size_t k = 0; k < rows.size(); k++) {
+            if (used[k]) {
+                matching.push_back({firstPart[rows[k]], secondPart[columns[k]]});
+            }
+        }
+        return matching;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка при поиске b-паросочетания: ") + e.what());
+        throw;
+    }
+}
+
+// k назначений наименьшей стоимости по возрастанию стоимости (алгоритм Мурти)
+// Пары и их веса берутся так же, как в solveAssignmentProblem. Если совершенных
+// назначений меньше k, возвращаются все; если их нет - пустой список
+std::vector<std::pair<double, std::vector<std::pair<int, int>>>> Graph::findKBestAssignments(
+    const std::vector<int>& firstPart,
+    const std::vector<int>& secondPart,
+    int k) {
+
+    try {
+        int n = firstPart.size();
+        if (n != static_cast<int>(secondPart.size())) {
+            throw std::invalid_argument("Размеры долей должны быть одинаковыми");
+        }
+
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<double> weights;
+        collectAssignmentPairs(firstPart, secondPart, rows, columns, weights);
+
+        std::vector<RankedAssignment> ranked = ::findKBestAssignments(n, rows.data(), columns.data(), weights.data(), rows.size(), k);
+
+        std::vector<std::pair<double, std::vector<std::pair<int, int>>>> result;
+        result.reserve(ranked.size());
+        for (const RankedAssignment& item : ranked) {
+            std::vector<std::pair<int, int>> matching;
+            matching.reserve(n);
+            for (int i = 0; i < n; i++) {
+                matching.push_back({firstPart[i], secondPart[item.assignment[i]]});
+            }
+            result.push_back({item.cost, std::move(matching)});
+        }
+        return result;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в алгоритме Мурти: ") + e.what());
+        throw;
+    }
+}
+
+// Включение поддержки максимального паросочетания
+// Паросочетание вычисляется при первом запросе и затем обновляется при каждом изменении графа
+void Graph::startMatchingTracking() noexcept {
+    if (matchingTracker.isEnabled()) {
+        return;
+    }
+    try {
+        matchingTracker.reset(vertexIds.size());
+    } catch (const std::bad_alloc&) {
+        matchingTracker.disable();
+        return;
+    }
+    for (size_t e = 0; e < edgeFrom.size() && matchingTracker.isEnabled(); e++) {
+        matchingTracker.addEdge(edgeFrom[e], edgeTo[e], false);
+    }
+}
+
+void Graph::stopMatchingTracking() noexcept {
+    matchingTracker.disable();
+}
+
+// Текущее максимальное паросочетание по плотным индексам, -1 для свободных вершин
+// Первый вызов включает поддержку; пока граф не меняется, повторные вызовы стоят O(1).
+// Направление рёбер не учитывается
+const std::vector<int>& Graph::getMatching() {
+    startMatchingTracking();
+    if (!matchingTracker.isEnabled()) {
+        throw std::bad_alloc();
+    }
+    return matchingTracker.getMatching();
+}
+
+int Graph::getMatchingSize() {
+    startMatchingTracking();
+    if (!matchingTracker.isEnabled()) {
+        throw std::bad_alloc();
+    }
+    return matchingTracker.getMatchingSize();
+}
 
-        if (vertices.empty()) {
-            return {};
+// Перевод массива пар по плотным индексам в список пар внешних ID
+std::vector<std::pair<int, int>> Graph::matchingToPairs(const std::vector<int>& match) const {
+    std::vector<std::pair<int, int>> result;
+    for (int i = 0; i < static_cast<int>(match.size()); i++) {
+        if (match[i] != -1 && i < match[i]) {
+            result.push_back({vertexIds[i], vertexIds[match[i]]});
         }
+    }
+    return result;
+}
+
+std::vector<std::pair<int, int>> Graph::findMaximumMatching() {
+    AlgorithmWorkspace workspace;
+    return matchingToPairs(findMaximumMatchingDense(workspace));
+}
 
-        std::map<int, int> idToIndex;
-        std::vector<int> indexToId;
-        for (const auto& vertex : vertices) {
-            idToIndex[vertex.getId()] = indexToId.size();
-            indexToId.push_back(vertex.getId());
+std::vector<int> Graph::findMaximumMatchingDense() {
+    AlgorithmWorkspace workspace;
+    return findMaximumMatchingDense(workspace);
+}
+
+// Алгоритм Эдмондса (сжатие цветков)
+// Возвращает пару каждой вершины по плотным индексам, -1 для свободных вершин.
+// Результат лежит в буфере рабочей области и действителен до следующего вызова с ней
+const std::vector<int>& Graph::findMaximumMatchingDense(AlgorithmWorkspace& workspace) {
+    SolveStatus status;
+    return findMaximumMatchingDense(workspace, SolveOptions(), status);
+}
+
+// Фаза - поиск увеличивающего пути из одной свободной вершины;
+// при отмене или истечении срока возвращается найденное к этому моменту паросочетание
+const std::vector<int>& Graph::findMaximumMatchingDense(AlgorithmWorkspace& workspace,
+                                                        const SolveOptions& options,
+                                                        SolveStatus& status) {
+    try {
+        GRAPH_STAT_TIMER(matchingSeconds);
+        for (unsigned char directed : edgeDirected) {
+            if (directed) {
+                throw std::invalid_argument("Алгоритм Эдмондса работает только с неориентированными графами");
+            }
         }
 
-        int n = vertices.size();
+        int n = vertexIds.size();
+        std::vector<int>& match = workspace.ints(AlgorithmWorkspace::Match, n, -1);
+        status = SolveStatus();
+        status.phasesTotal = n;
 
-        std::vector<std::vector<int>> adj(n);
-        for (const auto& edge : edges) {
-            int u = idToIndex[edge.getFromId()];
-            int v = idToIndex[edge.getToId()];
-            adj[u].push_back(v);
-            adj[v].push_back(u);
+        if (n == 0) {
+            return match;
         }
 
-        std::vector<int> match(n, -1);
-        std::vector<int> parent(n), base(n), color(n);
+        buildAdjacency();
+        const std::vector<int>& offsets = adjacencyOffsets;
+        const std::vector<int>& targets = adjacencyTargets;
+
+        std::vector<int>& parent = workspace.ints(AlgorithmWorkspace::Parent, n, -1);
+        std::vector<int>& base = workspace.ints(AlgorithmWorkspace::Base, n, 0);
+        std::vector<int>& color = workspace.ints(AlgorithmWorkspace::Color, n, 0);
+        std::vector<int>& blossom = workspace.ints(AlgorithmWorkspace::Blossom, n, 0);
+        std::vector<int>& q = workspace.cleared(AlgorithmWorkspace::Queue, n);
 
         auto lca = [&](int a, int b) {
-            std::vector<bool> used(n, false);
+            int mark = workspace.nextMark(AlgorithmWorkspace::Mark, n);
+            std::vector<int>& used = workspace.ints(AlgorithmWorkspace::Mark);
             while (true) {
                 a = base[a];
-                used[a] = true;
+                used[a] = mark;
                 if (match[a] == -1) break;
                 a = parent[match[a]];
             }
             while (true) {
                 b = base[b];
-                if (used[b]) return b;
+                if (used[b] == mark) return b;
                 b = parent[match[b]];
             }
             return -1;
@@ -619,34 +1861,56 @@ std::vector<std::pair<int, int>> Graph::findMaximumMatching() {
 
         auto mark_path = [&](int v, int b, int children) {
             while (base[v] != b) {
-                color[base[v]] = color[base[match[v]]] = 1;
+                blossom[base[v]] = blossom[base[match[v]]] = 1;
                 parent[v] = children;
                 children = match[v];
                 v = parent[match[v]];
             }
         };
 
+        // color[v] == 1 - внешняя (чётная) вершина дерева поиска,
+        // parent[v] != -1 - внутренняя (нечётная) вершина
         auto bfs = [&](int start) -> bool {
+            GRAPH_STAT_ADD(bfsPhases, 1);
             std::fill(parent.begin(), parent.end(), -1);
             std::fill(color.begin(), color.end(), 0);
             for (int i = 0; i < n; i++) base[i] = i;
 
-            std::queue<int> q;
-            q.push(start);
+            q.clear();
+            size_t head = 0;
+            q.push_back(start);
             color[start] = 1;
 
-            while (!q.empty()) {
-                int u = q.front();
-                q.pop();
+            while (head < q.size()) {
+                int u = q[head++];
+                GRAPH_STAT_ADD(edgesScanned, offsets[u + 1] - offsets[u]);
 
-                for (int v : adj[u]) {
-                    if (base[u] == base[v] || color[v] == 2) continue;
+                for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                    int v = targets[k];
+                    if (base[u] == base[v] || match[u] == v) continue;
+
+                    if (v == start || (match[v] != -1 && parent[match[v]] != -1)) {
+                        // Нечётный цикл: сжимаем цветок в его базу
+                        GRAPH_STAT_ADD(blossomsContracted, 1);
+                        int b = lca(u, v);
+                        std::fill(blossom.begin(), blossom.end(), 0);
+                        mark_path(u, b, v);
+                        mark_path(v, b, u);
 
-                    if (color[v] == 0) {
-                        color[v] = 2;
+                        for (int i = 0; i < n; i++) {
+                            if (blossom[base[i]]) {
+                                base[i] = b;
+                                if (color[i] != 1) {
+                                    color[i] = 1;
+                                    q.push_back(i);
+                                }
+                            }
+                        }
+                    } else if (parent[v] == -1) {
                         parent[v] = u;
 
                         if (match[v] == -1) {
+                            GRAPH_STAT_ADD(augmentingPaths, 1);
                             while (v != -1) {
                                 int pv = parent[v];
                                 int ppv = match[pv];
@@ -658,108 +1922,264 @@ std::vector<std::pair<int, int>> Graph::findMaximumMatching() {
                         }
 
                         color[match[v]] = 1;
-                        q.push(match[v]);
-                    } else {
-                        int b = lca(u, v);
-                        mark_path(u, b, v);
-                        mark_path(v, b, u);
-
-                        for (int i = 0; i < n; i++) {
-                            if (color[base[i]] == 1) {
-                                base[i] = b;
-                                if (color[i] == 1) {
-                                    color[i] = 2;
-                                    q.push(i);
-                                }
-                            }
-                        }
+                        q.push_back(match[v]);
                     }
                 }
             }
             return false;
         };
 
-        bool improved = true;
-        while (improved) {
-            improved = false;
-            for (int i = 0; i < n; i++) {
-                if (match[i] == -1 && bfs(i)) {
-                    improved = true;
+        // Вершина, из которой не нашлось увеличивающего пути, не получит его и позже,
+        // поэтому достаточно одного прохода по свободным вершинам
+        for (int i = 0; i < n; i++) {
+            if (match[i] == -1) {
+                if (options.shouldStop()) {
+                    status.complete = false;
+                    break;
                 }
+                bfs(i);
             }
-        }
-
-        std::vector<std::pair<int, int>> result;
-        for (int i = 0; i < n; i++) {
-            if (match[i] != -1 && i < match[i]) {
-                result.push_back({indexToId[i], indexToId[match[i]]});
+            status.phasesDone = i + 1;
+            if (options.progress) {
+                options.progress(i + 1, n);
             }
         }
 
-        return result;
+        return match;
 
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка в алгоритме Эдмондса: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка в алгоритме Эдмондса: ") + e.what());
         throw;
     }
 }
 
-std::vector<std::pair<int, int>> Graph::findMaximumMatchingBipartite() {
+std::vector<std::pair<int, int>> Graph::findMaximumMatching(GallaiEdmonds& decomposition) {
+    AlgorithmWorkspace workspace;
+    return matchingToPairs(findMaximumMatchingDense(workspace, decomposition));
+}
+
+// Максимальное паросочетание вместе с разложением Галлаи-Эдмондса и сертификатом
+// После алгоритма Эдмондса строится ещё один лес из всех свободных вершин сразу:
+// паросочетание максимально, поэтому лес растёт без увеличения, а его внешние вершины
+// (с учётом сжатых цветков) и есть D. Компоненты D и C находятся обходом в ширину
+const std::vector<int>& Graph::findMaximumMatchingDense(AlgorithmWorkspace& workspace, GallaiEdmonds& decomposition) {
+    const std::vector<int>& match = findMaximumMatchingDense(workspace);
     try {
-        std::map<int, int> partition;
-        if (!isBipartite(partition)) {
-            throw std::invalid_argument("Граф не является двудольным");
+        int n = vertexIds.size();
+        const std::vector<int>& offsets = adjacencyOffsets;
+        const std::vector<int>& targets = adjacencyTargets;
+
+        std::vector<int>& parent = workspace.ints(AlgorithmWorkspace::Parent, n, -1);
+        std::vector<int>& base = workspace.ints(AlgorithmWorkspace::Base, n, 0);
+        std::vector<int>& color = workspace.ints(AlgorithmWorkspace::Color, n, 0);
+        std::vector<int>& blossom = workspace.ints(AlgorithmWorkspace::Blossom, n, 0);
+        std::vector<int>& q = workspace.cleared(AlgorithmWorkspace::Queue, n);
+        for (int i = 0; i < n; i++) {
+            base[i] = i;
+            if (match[i] == -1) {
+                color[i] = 1;
+                q.push_back(i);
+            }
         }
 
-        if (vertices.empty()) {
-            return {};
+        // Общий предок в дереве: корень дерева - свободная вершина
+        auto lca = [&](int a, int b) {
+            int mark = workspace.nextMark(AlgorithmWorkspace::Mark, n);
+            std::vector<int>& used = workspace.ints(AlgorithmWorkspace::Mark);
+            while (true) {
+                a = base[a];
+                used[a] = mark;
+                if (match[a] == -1) break;
+                a = parent[match[a]];
+            }
+            while (true) {
+                b = base[b];
+                if (used[b] == mark) return b;
+                b = parent[match[b]];
+            }
+        };
+
+        auto mark_path = [&](int v, int b, int children) {
+            while (base[v] != b) {
+                blossom[base[v]] = blossom[base[match[v]]] = 1;
+                parent[v] = children;
+                children = match[v];
+                v = parent[match[v]];
+            }
+        };
+
+        GRAPH_STAT_ADD(bfsPhases, 1);
+        for (size_t head = 0; head < q.size(); head++) {
+            int u = q[head];
+            GRAPH_STAT_ADD(edgesScanned, offsets[u + 1] - offsets[u]);
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                int v = targets[k];
+                if (base[u] == base[v] || match[u] == v) continue;
+
+                if (color[v] == 1) {
+                    // Обе вершины внешние; ребро между разными деревьями дало бы
+                    // увеличивающий путь, значит это цветок внутри одного дерева
+                    GRAPH_STAT_ADD(blossomsContracted, 1);
+                    int b = lca(u, v);
+                    std::fill(blossom.begin(), blossom.end(), 0);
+                    mark_path(u, b, v);
+                    mark_path(v, b, u);
+                    for (int i = 0; i < n; i++) {
+                        if (blossom[base[i]]) {
+                            base[i] = b;
+                            if (color[i] != 1) {
+                                color[i] = 1;
+                                q.push_back(i);
+                            }
+                        }
+                    }
+                } else if (parent[v] == -1) {
+                    parent[v] = u;
+                    color[match[v]] = 1;
+                    q.push_back(match[v]);
+                }
+            }
         }
 
-        std::vector<int> left, right;
-        for (const auto& vertex : vertices) {
-            if (partition[vertex.getId()] == 0) {
-                left.push_back(vertex.getId());
-            } else {
-                right.push_back(vertex.getId());
+        std::vector<unsigned char>& kind = decomposition.kind;
+        kind.assign(n, GallaiEdmonds::C);
+        for (int v = 0; v < n; v++) {
+            if (color[v] == 1) {
+                kind[v] = GallaiEdmonds::D;
+            }
+        }
+        for (int v = 0; v < n; v++) {
+            if (kind[v] != GallaiEdmonds::D) {
+                continue;
+            }
+            for (int k = offsets[v]; k < offsets[v + 1]; k++) {
+                if (kind[targets[k]] != GallaiEdmonds::D) {
+                    kind[targets[k]] = GallaiEdmonds::A;
+                }
+            }
+        }
+
+        // Компоненты D и C (рёбра внутри одного вида; между D и C рёбер нет)
+        decomposition.coverVertices.clear();
+        decomposition.oddSetOffsets.assign(1, 0);
+        decomposition.oddSetVertices.clear();
+        int matchedPairs = 0;
+        for (int v = 0; v < n; v++) {
+            if (kind[v] == GallaiEdmonds::A) {
+                decomposition.coverVertices.push_back(v);
+            }
+            if (match[v] > v) {
+                matchedPairs++;
             }
         }
 
-        std::map<int, int> idToIndex;
-        std::vector<int> indexToId;
-        for (const auto& vertex : vertices) {
-            idToIndex[vertex.getId()] = indexToId.size();
-            indexToId.push_back(vertex.getId());
+        int mark = workspace.nextMark(AlgorithmWorkspace::Mark, n);
+        std::vector<int>& visited = workspace.ints(AlgorithmWorkspace::Mark);
+        for (int start = 0; start < n; start++) {
+            if (kind[start] == GallaiEdmonds::A || visited[start] == mark) {
+                continue;
+            }
+            q.clear();
+            q.push_back(start);
+            visited[start] = mark;
+            for (size_t head = 0; head < q.size(); head++) {
+                int u = q[head];
+                for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                    int v = targets[k];
+                    if (kind[v] == kind[start] && visited[v] != mark) {
+                        visited[v] = mark;
+                        q.push_back(v);
+                    }
+                }
+            }
+
+            // Чётная компонента C: одна вершина в покрытие, остальные - нечётное множество
+            size_t first = 0;
+            if (kind[start] == GallaiEdmonds::C) {
+                decomposition.coverVertices.push_back(q[0]);
+                first = 1;
+            }
+            decomposition.oddSetVertices.insert(decomposition.oddSetVertices.end(), q.begin() + first, q.end());
+            decomposition.oddSetOffsets.push_back(decomposition.oddSetVertices.size());
+        }
+
+        int dual = decomposition.coverVertices.size();
+        for (size_t s = 0; s + 1 < decomposition.oddSetOffsets.size(); s++) {
+            dual += (decomposition.oddSetOffsets[s + 1] - decomposition.oddSetOffsets[s] - 1) / 2;
+        }
+        decomposition.dualValue = dual;
+        if (dual != matchedPairs) {
+            logMessage(LogLevel::Error, "Сертификат Галлаи-Эдмондса не совпал с размером паросочетания");
+        }
+        return match;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в разложении Галлаи-Эдмондса: ") + e.what());
+        throw;
+    }
+}
+
+std::vector<std::pair<int, int>> Graph::findMaximumMatchingBipartite() {
+    AlgorithmWorkspace workspace;
+    return matchingToPairs(findMaximumMatchingBipartiteDense(workspace));
+}
+
+std::vector<int> Graph::findMaximumMatchingBipartiteDense() {
+    AlgorithmWorkspace workspace;
+    return findMaximumMatchingBipartiteDense(workspace);
+}
+
+// Алгоритм Куна с поиском увеличивающих путей в ширину
+// Возвращает пару каждой вершины по плотным индексам, -1 для свободных вершин.
+// Результат лежит в буфере рабочей области и действителен до следующего вызова с ней
+const std::vector<int>& Graph::findMaximumMatchingBipartiteDense(AlgorithmWorkspace& workspace) {
+    try {
+        GRAPH_STAT_TIMER(bipartiteMatchingSeconds);
+        std::vector<int>& partition = workspace.ints(AlgorithmWorkspace::Partition, 0, 0);
+        if (!isBipartite(partition, workspace)) {
+            throw std::invalid_argument("Граф не является двудольным");
         }
 
-        int n = vertices.size();
-        int leftSize = left.size();
+        int n = vertexIds.size();
+        std::vector<int>& match = workspace.ints(AlgorithmWorkspace::Match, n, -1);
 
-        std::vector<std::vector<bool>> adj(n, std::vector<bool>(n, false));
-        for (const auto& edge : edges) {
-            int u = idToIndex[edge.getFromId()];
-            int v = idToIndex[edge.getToId()];
-            adj[u][v] = adj[v][u] = true;
+        if (n == 0 || findMaximumMatchingBipartiteBits(partition, match, workspace)) {
+            return match;
         }
 
-        std::vector<int> match(n, -1);
+        const std::vector<int>& offsets = adjacencyOffsets;
+        const std::vector<int>& targets = adjacencyTargets;
 
-        for (int u = 0; u < leftSize; u++) {
-            std::vector<bool> used(n, false);
-            std::vector<int> parent(n, -1);
-            std::queue<int> q;
+        // Посещённые вершины отмечаются меткой текущего поиска, а parent читается
+        // только для посещённых, поэтому между поисками буферы не сбрасываются
+        std::vector<int>& parent = workspace.ints(AlgorithmWorkspace::Parent, n, -1);
+        std::vector<int>& q = workspace.cleared(AlgorithmWorkspace::Queue, n);
 
-            q.push(u);
-            used[u] = true;
+        for (int u = 0; u < n; u++) {
+            if (partition[u] != 0) {
+                continue;
+            }
+
+            int mark = workspace.nextMark(AlgorithmWorkspace::Mark, n);
+            std::vector<int>& used = workspace.ints(AlgorithmWorkspace::Mark);
+            GRAPH_STAT_ADD(bfsPhases, 1);
+
+            q.clear();
+            size_t head = 0;
+            q.push_back(u);
+            used[u] = mark;
+            parent[u] = -1;
             bool found = false;
             int last = -1;
 
-            while (!q.empty() && !found) {
-                int current = q.front();
-                q.pop();
+            while (head < q.size() && !found) {
+                int current = q[head++];
+                GRAPH_STAT_ADD(edgesScanned, offsets[current + 1] - offsets[current]);
 
-                for (int v = leftSize; v < n; v++) {
-                    if (adj[current][v] && !used[v]) {
-                        used[v] = true;
+                for (int k = offsets[current]; k < offsets[current + 1]; k++) {
+                    int v = targets[k];
+                    if (partition[v] == 1 && used[v] != mark) {
+                        used[v] = mark;
                         parent[v] = current;
 
                         if (match[v] == -1) {
@@ -767,15 +2187,16 @@ std::vector<std::pair<int, int>> Graph::findMaximumMatchingBipartite() {
                             last = v;
                             break;
                         } else {
-                            q.push(match[v]);
+                            q.push_back(match[v]);
                             parent[match[v]] = v;
-                            used[match[v]] = true;
+                            used[match[v]] = mark;
                         }
                     }
                 }
             }
 
             if (found) {
+                GRAPH_STAT_ADD(augmentingPaths, 1);
                 int v = last;
                 while (v != -1) {
                     int p = parent[v];
@@ -787,17 +2208,321 @@ std::vector<std::pair<int, int>> Graph::findMaximumMatchingBipartite() {
             }
         }
 
-        std::vector<std::pair<int, int>> result;
-        for (int i = 0; i < n; i++) {
-            if (match[i] != -1 && i < match[i]) {
-                result.push_back({indexToId[i], indexToId[match[i]]});
+        return match;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в алгоритме Куна: ") + e.what());
+        throw;
+    }
+}
+
+// Паросочетание плотного двудольного графа над битовой матрицей смежности (bitmatching.h)
+// Возвращает false, не трогая match, если граф недостаточно плотный или матрица велика.
+// Рёбра между вершинами одной доли (возможны при ориентированных рёбрах) не учитываются,
+// как и в алгоритме Куна по спискам смежности
+bool Graph::findMaximumMatchingBipartiteBits(const std::vector<int>& partition, std::vector<int>& match, AlgorithmWorkspace& workspace) {
+    int n = vertexIds.size();
+    int rowCount = std::count(partition.begin(), partition.end(), 0);
+    int columnCount = n - rowCount;
+    std::size_t words = bitMatchingWords(columnCount);
+    if (columnCount < kBitMatchingMinSize || rowCount * words > kBitMatchingMaxWords ||
+        edgeFrom.size() * kBitMatchingDensity < static_cast<std::size_t>(rowCount) * columnCount) {
+        return false;
+    }
+
+    // Номер вершины внутри своей доли и вершины строк и столбцов
+    std::vector<int>& local = workspace.ints(AlgorithmWorkspace::Assignment, n, -1);
+    std::vector<int>& rows = workspace.cleared(AlgorithmWorkspace::ColumnHead, rowCount);
+    std::vector<int>& columns = workspace.cleared(AlgorithmWorkspace::ColumnNext, columnCount);
+    for (int v = 0; v < n; v++) {
+        std::vector<int>& side = partition[v] == 0 ? rows : columns;
+        local[v] = side.size();
+        side.push_back(v);
+    }
+
+    std::vector<std::uint64_t>& adjacency = workspace.words(AlgorithmWorkspace::AdjacencyBits, rowCount * words, 0);
+    for (size_t e = 0; e < edgeFrom.size(); e++) {
+        int a = edgeFrom[e];
+        int b = edgeTo[e];
+        if (partition[a] == partition[b]) {
+            continue;
+        }
+        if (partition[a] != 0) {
+            std::swap(a, b);
+        }
+        adjacency[local[a] * words + local[b] / 64] |= std::uint64_t(1) << (local[b] % 64);
+    }
+
+    std::vector<int>& rowMatch = workspace.ints(AlgorithmWorkspace::Way, rowCount, -1);
+    std::vector<int>& columnMatch = workspace.ints(AlgorithmWorkspace::Used, columnCount, -1);
+    runBitMatching(rowCount, columnCount, workspace, rowMatch.data(), columnMatch.data());
+    for (int r = 0; r < rowCount; r++) {
+        if (rowMatch[r] != -1) {
+            match[rows[r]] = columns[rowMatch[r]];
+            match[columns[rowMatch[r]]] = rows[r];
+        }
+    }
+    return true;
+}
+
+std::vector<std::pair<int, int>> Graph::findMaximumMatchingBipartiteParallel(int threads) {
+    AlgorithmWorkspace workspace;
+    ParallelBipartiteMatcher matcher(threads);
+    return matchingToPairs(findMaximumMatchingBipartiteDense(workspace, matcher));
+}
+
+// Максимальное паросочетание двудольного графа параллельным поиском из всех свободных
+// вершин сразу (см. ParallelBipartiteMatcher). Результат - как у алгоритма Куна:
+// пары по плотным индексам в буфере рабочей области, -1 для свободных вершин
+const std::vector<int>& Graph::findMaximumMatchingBipartiteDense(AlgorithmWorkspace& workspace, ParallelBipartiteMatcher& matcher) {
+    try {
+        GRAPH_STAT_TIMER(bipartiteMatchingSeconds);
+        std::vector<int>& partition = workspace.ints(AlgorithmWorkspace::Partition, 0, 0);
+        if (!isBipartite(partition, workspace)) {
+            throw std::invalid_argument("Граф не является двудольным");
+        }
+
+        int n = vertexIds.size();
+        std::vector<int>& match = workspace.ints(AlgorithmWorkspace::Match, n, -1);
+        if (n == 0) {
+            return match;
+        }
+
+        matcher.solve(n, adjacencyOffsets.data(), adjacencyTargets.data(), partition.data(), match.data());
+        return match;
+
+    } catch (const std::exception& e) {
+        logMessage(LogLevel::Error, std::string("Ошибка в параллельном поиске паросочетания: ") + e.what());
+        throw;
+    }
+}
+
+std::vector<std::pair<int, int>> Graph::findMaximumMatchingBipartite(std::vector<int>& vertexCover, std::vector<int>& independentSet) {
+    AlgorithmWorkspace workspace;
+    std::vector<unsigned char> inCover;
+    std::vector<std::pair<int, int>> matching = matchingToPairs(findMaximumMatchingBipartiteDense(workspace, inCover));
+
+    vertexCover.clear();
+    independentSet.clear();
+    for (int i = 0; i < static_cast<int>(inCover.size()); i++) {
+        (inCover[i] ? vertexCover : independentSet).push_back(vertexIds[i]);
+    }
+    return matching;
+}
+
+// Максимальное паросочетание вместе с минимальным вершинным покрытием по теореме Кёнига
+// Z - вершины, достижимые из свободных вершин первой доли чередующимися путями
+// (в другую долю - по любому ребру, обратно - по ребру паросочетания). Покрытие -
+// вершины первой доли вне Z и второй доли в Z: inCover[i] == 1. Остальные вершины
+// образуют максимальное независимое множество. Один обход за O(V + E) после паросочетания
+const std::vector<int>& Graph::findMaximumMatchingBipartiteDense(AlgorithmWorkspace& workspace, std::vector<unsigned char>& inCover) {
+    const std::vector<int>& match = findMaximumMatchingBipartiteDense(workspace);
+    const std::vector<int>& partition = workspace.ints(AlgorithmWorkspace::Partition);
+    int n = vertexIds.size();
+
+    int mark = workspace.nextMark(AlgorithmWorkspace::Mark, n);
+    std::vector<int>& reached = workspace.ints(AlgorithmWorkspace::Mark);
+    std::vector<int>& q = workspace.cleared(AlgorithmWorkspace::Queue, n);
+    for (int u = 0; u < n; u++) {
+        if (partition[u] == 0 && match[u] == -1) {
+            reached[u] = mark;
+            q.push_back(u);
+        }
+    }
+
+    for (size_t head = 0; head < q.size(); head++) {
+        int u = q[head];
+        GRAPH_STAT_ADD(edgesScanned, adjacencyOffsets[u + 1] - adjacencyOffsets[u]);
+        for (int k = adjacencyOffsets[u]; k < adjacencyOffsets[u + 1]; k++) {
+            int v = adjacencyTargets[k];
+            if (partition[v] != 1 || reached[v] == mark) {
+                continue;
+            }
+            reached[v] = mark;
+            // Паросочетание максимально, поэтому v занята
+            int w = match[v];
+            if (w != -1 && reached[w] != mark) {
+                reached[w] = mark;
+                q.push_back(w);
             }
         }
+    }
 
-        return result;
+    inCover.resize(n);
+    for (int i = 0; i < n; i++) {
+        bool inZ = reached[i] == mark;
+        inCover[i] = partition[i] == 0 ? !inZ : inZ;
+    }
+    return match;
+}
+
+DulmageMendelsohn Graph::findDulmageMendelsohn() {
+    AlgorithmWorkspace workspace;
+    DulmageMendelsohn result;
+    findDulmageMendelsohn(result, workspace);
+    return result;
+}
+
+// Разложение Дюлмажа-Мендельсона за O(V + E) после паросочетания:
+// два обхода чередующимися путями из свободных вершин каждой доли и алгоритм Тарьяна
+// на вершинах первой доли из Square (дуга l -> match[r] для ребра l - r не из паросочетания)
+void Graph::findDulmageMendelsohn(DulmageMendelsohn& result, AlgorithmWorkspace& workspace) {
+    try {
+        const std::vector<int>& match = findMaximumMatchingBipartiteDense(workspace);
+        const std::vector<int>& partition = workspace.ints(AlgorithmWorkspace::Partition);
+        int n = vertexIds.size();
+        std::vector<unsigned char>& part = result.part;
+        part.assign(n, DulmageMendelsohn::Square);
+
+        std::vector<int>& q = workspace.cleared(AlgorithmWorkspace::Queue, n);
+        auto reachFromFree = [&](int side, DulmageMendelsohn::Part value) {
+            q.clear();
+            for (int u = 0; u < n; u++) {
+                if (partition[u] == side && match[u] == -1) {
+                    part[u] = value;
+                    q.push_back(u);
+                }
+            }
+            for (size_t head = 0; head < q.size(); head++) {
+                int u = q[head];
+                GRAPH_STAT_ADD(edgesScanned, adjacencyOffsets[u + 1] - adjacencyOffsets[u]);
+                for (int k = adjacencyOffsets[u]; k < adjacencyOffsets[u + 1]; k++) {
+                    int v = adjacencyTargets[k];
+                    if (partition[v] == side || part[v] != DulmageMendelsohn::Square) {
+                        continue;
+                    }
+                    part[v] = value;
+                    int w = match[v];
+                    if (w != -1 && part[w] == DulmageMendelsohn::Square) {
+                        part[w] = value;
+                        q.push_back(w);
+                    }
+                }
+            }
+        };
+        reachFromFree(0, DulmageMendelsohn::FirstSurplus);
+        reachFromFree(1, DulmageMendelsohn::SecondSurplus);
+
+        // Итеративный Тарьян: order - номер входа (-1 - не посещена), low - наименьший
+        // достижимый номер, next - следующая позиция в списке смежности
+        std::vector<int>& block = result.block;
+        block.assign(n, -1);
+        result.blockCount = 0;
+        std::vector<int>& order = workspace.ints(AlgorithmWorkspace::Color, n, -1);
+        std::vector<int>& low = workspace.ints(AlgorithmWorkspace::Base, n, 0);
+        std::vector<int>& next = workspace.ints(AlgorithmWorkspace::Way, n, 0);
+        std::vector<int>& onStack = workspace.ints(AlgorithmWorkspace::Used, n, 0);
+        std::vector<int>& componentStack = workspace.cleared(AlgorithmWorkspace::Stack, n);
+        std::vector<int>& callStack = q;
+        int counter = 0;
+
+        for (int start = 0; start < n; start++) {
+            if (partition[start] != 0 || part[start] != DulmageMendelsohn::Square || order[start] != -1) {
+                continue;
+            }
+            callStack.clear();
+            auto enter = [&](int u) {
+                order[u] = low[u] = counter++;
+                next[u] = adjacencyOffsets[u];
+                componentStack.push_back(u);
+                onStack[u] = 1;
+                callStack.push_back(u);
+            };
+            enter(start);
+
+            while (!callStack.empty()) {
+                int u = callStack.back();
+                if (next[u] < adjacencyOffsets[u + 1]) {
+                    int r = adjacencyTargets[next[u]++];
+                    if (partition[r] != 1 || r == match[u] || part[r] != DulmageMendelsohn::Square) {
+                        continue;
+                    }
+                    int w = match[r];
+                    if (order[w] == -1) {
+                        enter(w);
+                    } else if (onStack[w]) {
+                        low[u] = std::min(low[u], order[w]);
+                    }
+                    continue;
+                }
+
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    int parent = callStack.back();
+                    low[parent] = std::min(low[parent], low[u]);
+                }
+                if (low[u] == order[u]) {
+                    int w;
+                    do {
+                        w = componentStack.back();
+                        componentStack.pop_back();
+                        onStack[w] = 0;
+                        block[w] = result.blockCount;
+                        block[match[w]] = result.blockCount;
+                    } while (w != u);
+                    result.blockCount++;
+                }
+            }
+        }
+
+        size_t m = edgeFrom.size();
+        result.allowedEdge.assign(m, 0);
+        result.allowedEdgeCount = 0;
+        for (size_t e = 0; e < m; e++) {
+            int a = edgeFrom[e];
+            int b = edgeTo[e];
+            int l = partition[a] == 0 ? a : b;
+            int r = partition[a] == 0 ? b : a;
+            bool allowed = match[a] == b ||
+                           part[l] == DulmageMendelsohn::FirstSurplus ||
+                           part[r] == DulmageMendelsohn::SecondSurplus ||
+                           (part[l] == DulmageMendelsohn::Square && part[r] == DulmageMendelsohn::Square &&
+                            block[l] == block[r]);
+            result.allowedEdge[e] = allowed;
+            result.allowedEdgeCount += allowed;
+        }
 
     } catch (const std::exception& e) {
-        std::cerr << "Ошибка в алгоритме Куна: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка в разложении Дюлмажа-Мендельсона: ") + e.what());
         throw;
     }
 }
+
+// Удаление рёбер, не входящих ни в одно максимальное паросочетание
+// Если граф состоит из работников и задач, у которых есть совершенное назначение,
+// удалённые рёбра не могут войти и в оптимальное назначение, поэтому solveAssignmentProblem
+// после удаления даёт тот же ответ на меньшей задаче. Возвращает число удалённых рёбер
+std::size_t Graph::removeUnmatchableEdges() {
+    DulmageMendelsohn decomposition = findDulmageMendelsohn();
+
+    size_t kept = 0;
+    for (size_t i = 0; i < edgeFrom.size(); i++) {
+        if (!decomposition.allowedEdge[i]) {
+            continue;
+        }
+        edgeFrom[kept] = edgeFrom[i];
+        edgeTo[kept] = edgeTo[i];
+        edgeWeights[kept] = edgeWeights[i];
+        edgeDirected[kept] = edgeDirected[i];
+        kept++;
+    }
+    size_t removed = edgeFrom.size() - kept;
+    if (removed == 0) {
+        return 0;
+    }
+    edgeFrom.resize(kept);
+    edgeTo.resize(kept);
+    edgeWeights.resize(kept);
+    edgeDirected.resize(kept);
+
+    if (bipartiteTracker.isEnabled()) {
+        bipartiteTracker.disable();
+        startBipartiteTracking();
+    }
+    if (matchingTracker.isEnabled()) {
+        matchingTracker.disable();
+        startMatchingTracking();
+    }
+    invalidateAdjacency();
+    return removed;
+}
@@ -3,6 +3,20 @@
 
 #include "vertex.h"
 #include "edge.h"
+#include "labelarena.h"
+#include "workspace.h"
+#include "status.h"
+#include "solveoptions.h"
+#include "bipartitetracker.h"
+#include "matchingtracker.h"
+#include "bottleneck.h"
+#include "capacitated.h"
+#include "mincostflow.h"
+#include "parallelmatching.h"
+#include "reordering.h"
+#include "bitmatching.h"
+#include "dulmagemendelsohn.h"
+#include "gallaiedmonds.h"
 #include <vector>
 #include <iostream>
 #include <fstream>
@@ -10,14 +24,97 @@
 #include <algorithm>
 #include <queue>
 #include <map>
+#include <cstdint>
+#include <unordered_map>
+
+class Graph;
+
+// Лёгкое представление вершины, хранящейся в графе
+// Не владеет данными, а ссылается на позицию в массивах графа
+class VertexView {
+private:
+    Graph* graph;
+    int index;
+
+public:
+    VertexView();
+    VertexView(Graph* graph, int index);
+    int getId() const;
+    std::string_view getLabel() const;
+    double getWeight() const;
+    void setLabel(const std::string& label);
+    void setWeight(double weight);
+    Vertex toVertex() const;
+    operator Vertex() const;
+    explicit operator bool() const;
+    VertexView* operator->();
+    const VertexView* operator->() const;
+};
+
+// Лёгкое представление ребра, хранящегося в графе
+class EdgeView {
+private:
+    const Graph* graph;
+    int index;
+
+public:
+    EdgeView();
+    EdgeView(const Graph* graph, int index);
+    int getFromId() const;
+    int getToId() const;
+    double getWeight() const;
+    bool getIsDirected() const;
+    Edge toEdge() const;
+    operator Edge() const;
+    explicit operator bool() const;
+    const EdgeView* operator->() const;
+};
 
 class Graph {
 private:
-    std::vector<Vertex> vertices;
-    std::vector<Edge> edges;
+    // Вершины хранятся структурой массивов: идентификаторы, веса и дескрипторы меток
+    std::vector<int> vertexIds;
+    std::vector<double> vertexWeights;
+    std::vector<LabelArena::Handle> vertexLabels;
+    LabelArena labels;
+
+    // Рёбра хранятся структурой массивов: концы (плотные индексы вершин), веса и флаги направленности
+    std::vector<int> edgeFrom;
+    std::vector<int> edgeTo;
+    std::vector<double> edgeWeights;
+    std::vector<unsigned char> edgeDirected;
+
+    // Отображение внешних ID вершин в плотные индексы 0..n-1 (обратное - vertexIds)
+    std::unordered_map<int, int> idToIndex;
+
+    // Кэш списков смежности в формате CSR, перестраивается после изменения графа
+    mutable std::vector<int> adjacencyOffsets;
+    mutable std::vector<int> adjacencyTargets;
+    mutable std::vector<int> adjacencyEdges;
+    mutable std::vector<unsigned char> adjacencyOutgoing;
+    mutable bool adjacencyValid;
+
+    // Двудольность, поддерживаемая при изменениях графа (включается первым вызовом isBipartite())
+    BipartiteTracker bipartiteTracker;
+
+    // Максимальное паросочетание, поддерживаемое при изменениях графа (включается первым вызовом getMatching())
+    MatchingTracker matchingTracker;
+
+    friend class VertexView;
+    friend class EdgeView;
 
-    void processEdge(int fromId, int toId, int fromPartition, std::map<int, int>& partition, std::queue<int>& bfsQueue, bool& isBipartiteGraph);
-    bool dfsHelper(int vertexId, int color, std::map<int, int>& partition);
+    std::string_view labelAt(int index);
+    GraphError insertVertex(int id, std::string_view label, double weight) noexcept;
+    GraphError insertEdge(int fromId, int toId, double weight, bool isDirected) noexcept;
+    void buildAdjacency() const;
+    void invalidateAdjacency();
+    std::vector<std::pair<int, int>> matchingToPairs(const std::vector<int>& match) const;
+    void collectAssignmentPairs(const std::vector<int>& firstPart, const std::vector<int>& secondPart, std::vector<int>& rows, std::vector<int>& columns, std::vector<double>& weights) const;
+    void collectCapacities(const std::vector<int>& part, std::vector<int>& capacity) const;
+    double solveSparseAssignment(const std::vector<int>& firstPart, const std::vector<int>& secondPart, std::vector<std::pair<int, int>>& matching, AlgorithmWorkspace& workspace, SolveStatus& status);
+    bool findMaximumMatchingBipartiteBits(const std::vector<int>& partition, std::vector<int>& match, AlgorithmWorkspace& workspace);
+    void processEdge(int from, int to, int fromPartition, std::vector<int>& partition, std::vector<int>& bfsQueue, bool& isBipartiteGraph);
+    bool dfsHelper(int start, int color, std::vector<int>& partition, std::vector<int>& stack);
 
 public:
     Graph();
@@ -25,17 +122,69 @@ public:
     void addEdge(const Edge& edge);
     void removeVertex(int id);
     void removeEdge(int fromId, int toId);
-    Vertex* getVertex(int id);
+    GraphError tryAddVertex(int id, std::string_view label, double weight) noexcept;
+    GraphError tryAddEdge(int fromId, int toId, double weight, bool isDirected) noexcept;
+    GraphError tryAddVertices(int firstId, int count, double weight) noexcept;
+    GraphError tryAddEdges(const int* fromIds, const int* toIds, const double* weights, std::size_t count, bool isDirected, bool checkDuplicates, std::size_t& added) noexcept;
+    void reserve(int vertexCount, int edgeCount);
+    void reorderVertices(const std::vector<int>& order);
+    std::vector<int> reorderVertices(VertexOrder order);
+    GraphError tryRemoveVertex(int id) noexcept;
+    GraphError tryRemoveEdge(int fromId, int toId) noexcept;
+    GraphError tryReadMatrix(std::istream& is) noexcept;
+    Expected<VertexView> findVertex(int id) noexcept;
+    VertexView getVertex(int id);
+    VertexView vertexAt(int index);
+    EdgeView edgeAt(int index) const;
     int getVertexCount() const;
     int getEdgeCount() const;
+    int indexOf(int id) const noexcept;
+    int idAt(int index) const;
+    bool isBipartite();
+    void startBipartiteTracking() noexcept;
+    void stopBipartiteTracking() noexcept;
     bool isBipartite(std::map<int, int>& partition);
+    bool isBipartite(std::vector<int>& partition);
+    bool isBipartite(std::vector<int>& partition, AlgorithmWorkspace& workspace);
     bool isBipartiteDFS(std::map<int, int>& partition);
+    bool isBipartiteDFS(std::vector<int>& partition);
+    bool isBipartiteDFS(std::vector<int>& partition, AlgorithmWorkspace& workspace);
+    bool findOddCycle(std::vector<int>& cycle);
     void printBipartiteInfo(const std::map<int, int>& partition) const;
     std::pair<double, std::vector<std::pair<int, int>>> solveAssignmentProblem(const std::vector<int>& firstPart, const std::vector<int>& secondPart);
+    double solveAssignmentProblem(const std::vector<int>& firstPart, const std::vector<int>& secondPart, std::vector<std::pair<int, int>>& matching, AlgorithmWorkspace& workspace);
+    double solveAssignmentProblem(const std::vector<int>& firstPart, const std::vector<int>& secondPart, std::vector<std::pair<int, int>>& matching, std::vector<double>& workerPotentials, std::vector<double>& taskPotentials);
+    double solveAssignmentProblem(const std::vector<int>& firstPart, const std::vector<int>& secondPart, std::vector<std::pair<int, int>>& matching, AlgorithmWorkspace& workspace, const SolveOptions& options, SolveStatus& status);
+    std::pair<double, std::vector<std::pair<int, int>>> solveBottleneckAssignment(const std::vector<int>& firstPart, const std::vector<int>& secondPart);
+    double solveBottleneckAssignment(const std::vector<int>& firstPart, const std::vector<int>& secondPart, std::vector<std::pair<int, int>>& matching, BottleneckAssignmentSolver& solver);
+    std::pair<double, std::vector<std::pair<int, int>>> solveCapacitatedAssignment(const std::vector<int>& firstPart, const std::vector<int>& secondPart);
+    double solveCapacitatedAssignment(const std::vector<int>& firstPart, const std::vector<int>& secondPart, std::vector<std::pair<int, int>>& matching, CapacitatedAssignmentSolver& solver);
+    std::pair<double, std::vector<std::int64_t>> solveMinCostFlow(const std::vector<std::int64_t>& supply, const std::vector<std::int64_t>& capacity);
+    double solveMinCostFlow(const std::vector<std::int64_t>& supply, const std::vector<std::int64_t>& capacity, std::vector<std::int64_t>& flow, MinCostFlowSolver& solver);
+    std::vector<std::pair<int, int>> findMaximumBMatching(const std::vector<int>& firstPart, const std::vector<int>& secondPart);
+    std::vector<std::pair<double, std::vector<std::pair<int, int>>>> findKBestAssignments(const std::vector<int>& firstPart, const std::vector<int>& secondPart, int k);
     std::vector<std::pair<int, int>> findMaximumMatching();
+    std::vector<int> findMaximumMatchingDense();
+    const std::vector<int>& findMaximumMatchingDense(AlgorithmWorkspace& workspace);
+    const std::vector<int>& findMaximumMatchingDense(AlgorithmWorkspace& workspace, const SolveOptions& options, SolveStatus& status);
+    std::vector<std::pair<int, int>> findMaximumMatching(GallaiEdmonds& decomposition);
+    const std::vector<int>& findMaximumMatchingDense(AlgorithmWorkspace& workspace, GallaiEdmonds& decomposition);
     std::vector<std::pair<int, int>> findMaximumMatchingBipartite();
+    std::vector<int> findMaximumMatchingBipartiteDense();
+    const std::vector<int>& findMaximumMatchingBipartiteDense(AlgorithmWorkspace& workspace);
+    std::vector<std::pair<int, int>> findMaximumMatchingBipartiteParallel(int threads = 0);
+    const std::vector<int>& findMaximumMatchingBipartiteDense(AlgorithmWorkspace& workspace, ParallelBipartiteMatcher& matcher);
+    std::vector<std::pair<int, int>> findMaximumMatchingBipartite(std::vector<int>& vertexCover, std::vector<int>& independentSet);
+    const std::vector<int>& findMaximumMatchingBipartiteDense(AlgorithmWorkspace& workspace, std::vector<unsigned char>& inCover);
+    DulmageMendelsohn findDulmageMendelsohn();
+    void findDulmageMendelsohn(DulmageMendelsohn& result, AlgorithmWorkspace& workspace);
+    std::size_t removeUnmatchableEdges();
+    const std::vector<int>& getMatching();
+    int getMatchingSize();
+    void startMatchingTracking() noexcept;
+    void stopMatchingTracking() noexcept;
     friend std::ostream& operator<<(std::ostream& os, const Graph& graph);
     friend std::istream& operator>>(std::istream& is, Graph& graph);
 };
 
-#endif // GRAPH_H
\ No newline at end of file
+#endif // GRAPH_H
@@ -0,0 +1,78 @@
+#include "labelarena.h"
+#include <stdexcept>
+#include <limits>
+#include <functional>
+
+LabelArena::LabelArena() : data(), offsets(), lengths(), slots() {}
+
+std::size_t LabelArena::hashLabel(std::string_view label) {
+    return std::hash<std::string_view>()(label);
+}
+
+// Перестроение таблицы интернирования (открытая адресация, линейное пробирование)
+void LabelArena::rehash(std::size_t capacity) {
+    slots.assign(capacity, kDeferred);
+    std::size_t mask = capacity - 1;
+    for (Handle handle = 0; handle < offsets.size(); handle++) {
+        std::size_t slot = hashLabel(get(handle)) & mask;
+        while (slots[slot] != kDeferred) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = handle;
+    }
+}
+
+// Интернирование метки
+// Если такая метка уже есть в арене, возвращается её дескриптор без выделения памяти
+LabelArena::Handle LabelArena::intern(std::string_view label) {
+    if (slots.empty()) {
+        rehash(16);
+    }
+
+    std::size_t mask = slots.size() - 1;
+    std::size_t slot = hashLabel(label) & mask;
+    while (slots[slot] != kDeferred) {
+        if (get(slots[slot]) == label) {
+            return slots[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    if (data.size() + label.size() > std::numeric_limits<std::uint32_t>::max() ||
+        offsets.size() >= kDeferred) {
+        throw std::length_error("Превышен размер арены меток");
+    }
+
+    Handle handle = static_cast<Handle>(offsets.size());
+    offsets.push_back(static_cast<std::uint32_t>(data.size()));
+    lengths.push_back(static_cast<std::uint32_t>(label.size()));
+    data.append(label.data(), label.size());
+    slots[slot] = handle;
+
+    // Держим заполнение таблицы не выше половины
+    if (offsets.size() * 2 > slots.size()) {
+        rehash(slots.size() * 2);
+    }
+    return handle;
+}
+
+// Получение метки по дескриптору без копирования
+// Представление действительно до следующего добавления метки в арену
+std::string_view LabelArena::get(Handle handle) const {
+    return std::string_view(data.data() + offsets[handle], lengths[handle]);
+}
+
+std::size_t LabelArena::size() const {
+    return offsets.size();
+}
+
+std::size_t LabelArena::bytes() const {
+    return data.size();
+}
+
+void LabelArena::clear() {
+    data.clear();
+    offsets.clear();
+    lengths.clear();
+    slots.clear();
+}
@@ -0,0 +1,36 @@
+#ifndef LABELARENA_H
+#define LABELARENA_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Арена меток вершин
+// Все метки хранятся подряд в одном буфере, вершина хранит только дескриптор.
+// Одинаковые метки интернируются и хранятся один раз.
+class LabelArena {
+public:
+    using Handle = std::uint32_t;
+
+    // Дескриптор метки, которая ещё не создана и будет синтезирована при первом обращении
+    static constexpr Handle kDeferred = 0xFFFFFFFFu;
+
+    LabelArena();
+    Handle intern(std::string_view label);
+    std::string_view get(Handle handle) const;
+    std::size_t size() const;
+    std::size_t bytes() const;
+    void clear();
+
+private:
+    std::string data;
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> lengths;
+    std::vector<Handle> slots;
+
+    static std::size_t hashLabel(std::string_view label);
+    void rehash(std::size_t capacity);
+};
+
+#endif // LABELARENA_H
@@ -0,0 +1,30 @@
+#include "logsink.h"
+#include <iostream>
+
+namespace {
+LogSink& currentSink() {
+    static LogSink sink = defaultLogSink;
+    return sink;
+}
+}
+
+void setLogSink(LogSink sink) {
+    currentSink() = std::move(sink);
+}
+
+void defaultLogSink(LogLevel level, std::string_view message) {
+    std::ostream& os = (level == LogLevel::Error) ? std::cerr : std::cout;
+    os << message << std::endl;
+}
+
+// Проверка перед форматированием сообщения, чтобы не собирать строку впустую
+bool isLoggingEnabled() {
+    return static_cast<bool>(currentSink());
+}
+
+void logMessage(LogLevel level, std::string_view message) {
+    const LogSink& sink = currentSink();
+    if (sink) {
+        sink(level, message);
+    }
+}
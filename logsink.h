@@ -0,0 +1,22 @@
+#ifndef LOGSINK_H
+#define LOGSINK_H
+
+#include <functional>
+#include <string_view>
+
+// Приёмник диагностических сообщений библиотеки
+// По умолчанию информационные сообщения идут в std::cout, ошибки - в std::cerr;
+// setLogSink(nullptr) полностью отключает вывод
+enum class LogLevel {
+    Info,
+    Error
+};
+
+using LogSink = std::function<void(LogLevel level, std::string_view message)>;
+
+void setLogSink(LogSink sink);
+void defaultLogSink(LogLevel level, std::string_view message);
+bool isLoggingEnabled();
+void logMessage(LogLevel level, std::string_view message);
+
+#endif // LOGSINK_H
@@ -371,6 +371,34 @@ int main() {
             std::cerr << "Ошибка: " << e.what() << std::endl;
         }
 
+        std::cout << "\n╔════════════════════════════════════════════════════╗" << std::endl;
+        std::cout << "║ ДЕМОНСТРАЦИЯ 11: Ориентированный граф              ║" << std::endl;
+        std::cout << "╚════════════════════════════════════════════════════╝" << std::endl;
+
+        try {
+            Graph directedGraph;
+
+            directedGraph.addVertex(Vertex(1, "A", 1.0));
+            directedGraph.addVertex(Vertex(2, "B", 1.0));
+            directedGraph.addVertex(Vertex(3, "C", 1.0));
+
+            directedGraph.addEdge(Edge(3, 1, 1.0, true));
+            directedGraph.addEdge(Edge(3, 2, 1.0, true));
+
+            std::cout << "\nГраф (звезда 3->1, 3->2, направление не учитывается):" << std::endl;
+            std::cout << directedGraph;
+
+            std::map<int, int> partitionDirected;
+            bool withPartition = directedGraph.isBipartite(partitionDirected);
+            bool tracked = directedGraph.isBipartite();
+            std::cout << "BFS с разбиением: " << (withPartition ? "ДВУДОЛЬНЫЙ " : "НЕ ДВУДОЛЬНЫЙ ") << std::endl;
+            std::cout << "Без разбиения: " << (tracked ? "ДВУДОЛЬНЫЙ " : "НЕ ДВУДОЛЬНЫЙ ") << std::endl;
+            std::cout << "Ответы " << (withPartition == tracked ? "совпадают" : "РАСХОДЯТСЯ") << std::endl;
+
+        } catch (const std::exception& e) {
+            std::cerr << "Ошибка: " << e.what() << std::endl;
+        }
+
         std::cout << "\n╔════════════════════════════════════════════════════╗" << std::endl;
         std::cout << "║ ПРОГРАММА ЗАВЕРШЕНА                                ║" << std::endl;
         std::cout << "╚════════════════════════════════════════════════════╝" << std::endl;
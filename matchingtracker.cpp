@@ -0,0 +1,267 @@
+#include "matchingtracker.h"
+#include <algorithm>
+#include <limits>
+#include <new>
+
+MatchingTracker::MatchingTracker()
+    : matchedPairs(0), enabled(false), dirty(false), lcaStamp(0) {}
+
+// Начало отслеживания графа из vertexCount изолированных вершин
+void MatchingTracker::reset(int vertexCount) {
+    match.assign(vertexCount, -1);
+    neighbors.assign(vertexCount, std::vector<int>());
+    lcaMark.assign(vertexCount, 0);
+    lcaStamp = 0;
+    matchedPairs = 0;
+    enabled = true;
+    dirty = false;
+}
+
+// Прекращение отслеживания с освобождением памяти
+void MatchingTracker::disable() noexcept {
+    *this = MatchingTracker();
+}
+
+bool MatchingTracker::isEnabled() const {
+    return enabled;
+}
+
+// Паросочетание будет пересчитано при следующем запросе
+void MatchingTracker::markDirty() {
+    dirty = true;
+}
+
+// Наименьший общий предок вершин a и b одного дерева с учётом сжатых цветков
+int MatchingTracker::lca(int a, int b) {
+    if (lcaStamp == std::numeric_limits<int>::max()) {
+        std::fill(lcaMark.begin(), lcaMark.end(), 0);
+        lcaStamp = 0;
+    }
+    int stamp = ++lcaStamp;
+    while (true) {
+        a = base[a];
+        lcaMark[a] = stamp;
+        if (match[a] == -1) break;
+        a = parent[match[a]];
+    }
+    while (true) {
+        b = base[b];
+        if (lcaMark[b] == stamp) return b;
+        b = parent[match[b]];
+    }
+}
+
+void MatchingTracker::markPath(int v, int b, int children) {
+    while (base[v] != b) {
+        blossom[base[v]] = blossom[base[match[v]]] = 1;
+        parent[v] = children;
+        children = match[v];
+        v = parent[match[v]];
+    }
+}
+
+// Чередование пути от внутренней вершины v до корня её дерева
+void MatchingTracker::flipToRoot(int v) {
+    while (v != -1) {
+        int pv = parent[v];
+        int ppv = match[pv];
+        match[v] = pv;
+        match[pv] = v;
+        v = ppv;
+    }
+}
+
+// Поиск одного увеличивающего пути лесом Эдмондса из свободных вершин roots
+// (rootCount == -1 - из всех свободных вершин). Если лес построен целиком без
+// увеличивающего пути, из этих корней путей нет. Возвращает true, если путь найден
+bool MatchingTracker::augment(const int* roots, int rootCount) {
+    int n = match.size();
+    parent.assign(n, -1);
+    rootOf.assign(n, -1);
+    outer.assign(n, 0);
+    blossom.assign(n, 0);
+    base.resize(n);
+    for (int i = 0; i < n; i++) {
+        base[i] = i;
+    }
+
+    queue.clear();
+    auto addRoot = [&](int r) {
+        if (match[r] == -1 && !outer[r]) {
+            outer[r] = 1;
+            rootOf[r] = r;
+            queue.push_back(r);
+        }
+    };
+    if (rootCount < 0) {
+        for (int r = 0; r < n; r++) {
+            addRoot(r);
+        }
+    } else {
+        for (int k = 0; k < rootCount; k++) {
+            addRoot(roots[k]);
+        }
+    }
+
+    size_t head = 0;
+    while (head < queue.size()) {
+        int u = queue[head++];
+
+        for (int v : neighbors[u]) {
+            if (base[u] == base[v] || match[u] == v) continue;
+
+            if (outer[v]) {
+                if (rootOf[v] != rootOf[u]) {
+                    // Ребро между деревьями: путь корень(u) .. u - v .. корень(v)
+                    int mateU = match[u];
+                    int mateV = match[v];
+                    if (mateU != -1) flipToRoot(mateU);
+                    if (mateV != -1) flipToRoot(mateV);
+                    match[u] = v;
+                    match[v] = u;
+                    matchedPairs++;
+                    return true;
+                }
+
+                // Нечётный цикл в одном дереве: сжимаем цветок в его базу
+                int b = lca(u, v);
+                std::fill(blossom.begin(), blossom.end(), 0);
+                markPath(u, b, v);
+                markPath(v, b, u);
+
+                for (int i = 0; i < n; i++) {
+                    if (blossom[base[i]]) {
+                        base[i] = b;
+                        if (!outer[i]) {
+                            outer[i] = 1;
+                            rootOf[i] = rootOf[u];
+                            queue.push_back(i);
+                        }
+                    }
+                }
+            } else if (parent[v] == -1) {
+                parent[v] = u;
+                rootOf[v] = rootOf[u];
+
+                if (match[v] == -1) {
+                    flipToRoot(v);
+                    matchedPairs++;
+                    return true;
+                }
+
+                int w = match[v];
+                outer[w] = 1;
+                rootOf[w] = rootOf[u];
+                queue.push_back(w);
+            }
+        }
+    }
+    return false;
+}
+
+// Полный пересчёт от текущего паросочетания: жадное дополнение
+// и поиск увеличивающих путей, пока они находятся
+void MatchingTracker::recompute() {
+    int n = match.size();
+    for (int u = 0; u < n; u++) {
+        if (match[u] != -1) continue;
+        for (int v : neighbors[u]) {
+            if (match[v] == -1) {
+                match[u] = v;
+                match[v] = u;
+                matchedPairs++;
+                break;
+            }
+        }
+    }
+    while (augment(nullptr, -1)) {
+    }
+    dirty = false;
+}
+
+// Изменения графа; при нехватке памяти отслеживание отключается
+void MatchingTracker::addVertex() noexcept {
+    try {
+        match.push_back(-1);
+        neighbors.emplace_back();
+        lcaMark.push_back(0);
+    } catch (const std::bad_alloc&) {
+        disable();
+    }
+}
+
+// Добавление ребра a - b; при repair == false паросочетание лишь помечается к пересчёту
+// Новый увеличивающий путь обязан проходить через новое ребро: если один из концов
+// свободен, путь начинается в нём, иначе ищется из всех свободных вершин
+void MatchingTracker::addEdge(int a, int b, bool repair) noexcept {
+    try {
+        neighbors[a].push_back(b);
+        neighbors[b].push_back(a);
+        if (!repair) {
+            dirty = true;
+        }
+        if (dirty) {
+            return;
+        }
+
+        if (match[a] == -1 && match[b] == -1) {
+            match[a] = b;
+            match[b] = a;
+            matchedPairs++;
+        } else if (match[a] == -1) {
+            augment(&a, 1);
+        } else if (match[b] == -1) {
+            augment(&b, 1);
+        } else if (static_cast<int>(match.size()) - 2 * matchedPairs >= 2) {
+            augment(nullptr, -1);
+        }
+    } catch (const std::bad_alloc&) {
+        disable();
+    }
+}
+
+// Удаление ребра a - b
+// Если из паросочетания ушло ребро, новый увеличивающий путь может начинаться
+// только в одной из двух освободившихся вершин
+void MatchingTracker::removeEdge(int a, int b) noexcept {
+    try {
+        for (auto [x, y] : {std::pair<int, int>(a, b), std::pair<int, int>(b, a)}) {
+            std::vector<int>& list = neighbors[x];
+            auto it = std::find(list.begin(), list.end(), y);
+            if (it != list.end()) {
+                *it = list.back();
+                list.pop_back();
+            }
+        }
+
+        bool stillAdjacent = std::find(neighbors[a].begin(), neighbors[a].end(), b) != neighbors[a].end();
+        if (match[a] != b || stillAdjacent) {
+            return;
+        }
+
+        match[a] = -1;
+        match[b] = -1;
+        matchedPairs--;
+        if (!dirty) {
+            int roots[2] = {a, b};
+            augment(roots, 2);
+        }
+    } catch (const std::bad_alloc&) {
+        disable();
+    }
+}
+
+// Текущее максимальное паросочетание по плотным индексам, -1 для свободных вершин
+const std::vector<int>& MatchingTracker::getMatching() {
+    if (dirty) {
+        recompute();
+    }
+    return match;
+}
+
+int MatchingTracker::getMatchingSize() {
+    if (dirty) {
+        recompute();
+    }
+    return matchedPairs;
+}
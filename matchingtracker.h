@@ -0,0 +1,54 @@
+#ifndef MATCHINGTRACKER_H
+#define MATCHINGTRACKER_H
+
+#include <vector>
+
+// Максимальное паросочетание, поддерживаемое при изменениях графа
+// Добавление ребра увеличивает паросочетание не более чем на одно ребро, поэтому
+// достаточно одного поиска увеличивающего пути; удаление ребра из паросочетания
+// чинится поиском из двух освободившихся вершин. Поиск - лес Эдмондса со сжатием цветков.
+// Направление рёбер не учитывается
+class MatchingTracker {
+private:
+    std::vector<int> match;
+    std::vector<std::vector<int>> neighbors;
+    int matchedPairs;
+    bool enabled;
+    bool dirty;
+
+    // Буферы поиска
+    std::vector<int> parent;
+    std::vector<int> base;
+    std::vector<int> rootOf;
+    std::vector<unsigned char> outer;
+    std::vector<unsigned char> blossom;
+    std::vector<int> lcaMark;
+    std::vector<int> queue;
+    int lcaStamp;
+
+    bool augment(const int* roots, int rootCount);
+    int lca(int a, int b);
+    void markPath(int v, int b, int children);
+    void flipToRoot(int v);
+    void recompute();
+
+public:
+    // Размер пакета изменений, после которого паросочетание пересчитывается целиком
+    static constexpr int kRecomputeThreshold = 64;
+
+    MatchingTracker();
+
+    void reset(int vertexCount);
+    void disable() noexcept;
+    bool isEnabled() const;
+    void markDirty();
+
+    void addVertex() noexcept;
+    void addEdge(int a, int b, bool repair = true) noexcept;
+    void removeEdge(int a, int b) noexcept;
+
+    const std::vector<int>& getMatching();
+    int getMatchingSize();
+};
+
+#endif // MATCHINGTRACKER_H
@@ -0,0 +1,336 @@
+#include "mincostflow.h"
+#include "stats.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Состояния дуг: без потока, в дереве, насыщена. Знак состояния вне дерева - направление,
+// в котором выгодно менять поток при отрицательной приведённой стоимости
+const signed char kLower = 1;
+const signed char kTree = 0;
+const signed char kUpper = -1;
+
+// Направление дуги к родителю: от узла к родителю или от родителя к узлу
+const signed char kUp = 1;
+const signed char kDown = -1;
+
+}
+
+MinCostFlowSolver::MinCostFlowSolver()
+    : nodeCount(0), arcCount(0), root(0), hasBasis(false), blockSize(0), nextArc(0),
+      tolerance(0.0), totalCost(0.0), pivots(0), entering(-1), join(-1), leavingNode(-1),
+      enteringInside(-1), enteringOutside(-1), delta(0) {}
+
+void MinCostFlowSolver::setNetwork(int nodeCount, const int* from, const int* to, const std::int64_t* capacity,
+                                   std::size_t arcCount, const std::int64_t* supply) {
+    this->nodeCount = nodeCount;
+    this->arcCount = arcCount;
+    root = nodeCount;
+
+    std::size_t total = arcCount + nodeCount;
+    arcSource.assign(from, from + arcCount);
+    arcTarget.assign(to, to + arcCount);
+    arcCapacity.assign(capacity, capacity + arcCount);
+    arcSource.resize(total);
+    arcTarget.resize(total);
+    arcCapacity.resize(total, kInfiniteCapacity);
+    arcFlow.assign(total, 0);
+    arcCost.assign(total, 0.0);
+    arcState.assign(total, kLower);
+    this->supply.assign(supply, supply + nodeCount);
+    hasBasis = false;
+}
+
+// Начальный базис: каждый узел связан с корнем искусственной дугой, по которой идёт
+// весь его баланс. Дуги к корню бесплатны, дуги из корня стоят больше любого пути,
+// поэтому поток по ним в оптимуме означает недопустимость балансов
+void MinCostFlowSolver::initializeTree() {
+    int size = nodeCount + 1;
+    parent.assign(size, -1);
+    pred.assign(size, -1);
+    predDirection.assign(size, kUp);
+    depth.assign(size, 0);
+    firstChild.assign(size, -1);
+    nextSibling.assign(size, -1);
+    prevSibling.assign(size, -1);
+    potential.assign(size, 0.0);
+
+    std::fill(arcFlow.begin(), arcFlow.begin() + arcCount, 0);
+    std::fill(arcState.begin(), arcState.begin() + arcCount, kLower);
+    for (int u = nodeCount - 1; u >= 0; u--) {
+        int e = arcCount + u;
+        arcState[e] = kTree;
+        parent[u] = root;
+        pred[u] = e;
+        if (supply[u] >= 0) {
+            arcSource[e] = u;
+            arcTarget[e] = root;
+            arcFlow[e] = supply[u];
+            predDirection[u] = kUp;
+        } else {
+            arcSource[e] = root;
+            arcTarget[e] = u;
+            arcFlow[e] = -supply[u];
+            predDirection[u] = kDown;
+        }
+        attach(u, root);
+    }
+    nextArc = 0;
+}
+
+// Потенциалы и глубины обходом дерева от корня: приведённые стоимости дуг дерева нулевые
+void MinCostFlowSolver::computePotentials(int from) {
+    stack.assign(1, from);
+    while (!stack.empty()) {
+        int x = stack.back();
+        stack.pop_back();
+        for (int c = firstChild[x]; c != -1; c = nextSibling[c]) {
+            potential[c] = potential[x] - predDirection[c] * arcCost[pred[c]];
+            depth[c] = depth[x] + 1;
+            stack.push_back(c);
+        }
+    }
+}
+
+double MinCostFlowSolver::reducedCost(int arc) const {
+    return arcCost[arc] + potential[arcSource[arc]] - potential[arcTarget[arc]];
+}
+
+void MinCostFlowSolver::attach(int child, int node) {
+    prevSibling[child] = -1;
+    nextSibling[child] = firstChild[node];
+    if (firstChild[node] != -1) {
+        prevSibling[firstChild[node]] = child;
+    }
+    firstChild[node] = child;
+}
+
+void MinCostFlowSolver::detach(int child, int node) {
+    if (prevSibling[child] != -1) {
+        nextSibling[prevSibling[child]] = nextSibling[child];
+    } else {
+        firstChild[node] = nextSibling[child];
+    }
+    if (nextSibling[child] != -1) {
+        prevSibling[nextSibling[child]] = prevSibling[child];
+    }
+}
+
+// Блочный поиск: из очередного блока дуг берётся самая нарушающая оптимальность;
+// если в блоке нарушений нет, просматривается следующий
+bool MinCostFlowSolver::findEnteringArc() {
+    double best = -tolerance;
+    entering = -1;
+    int count = blockSize;
+    for (int step = 0; step < arcCount; step++) {
+        int e = nextArc + step < arcCount ? nextArc + step : nextArc + step - arcCount;
+        if (arcState[e] != kTree) {
+            double violation = arcState[e] * reducedCost(e);
+            if (violation < best) {
+                best = violation;
+                entering = e;
+            }
+        }
+        if (--count == 0) {
+            if (entering != -1) {
+                nextArc = e + 1 < arcCount ? e + 1 : 0;
+                return true;
+            }
+            count = blockSize;
+        }
+    }
+    return entering != -1;
+}
+
+void MinCostFlowSolver::findJoinNode() {
+    int u = arcSource[entering];
+    int v = arcTarget[entering];
+    while (u != v) {
+        if (depth[u] >= depth[v]) {
+            u = parent[u];
+        } else {
+            v = parent[v];
+        }
+    }
+    join = u;
+}
+
+// Выходящая дуга - последняя блокирующая по направлению цикла (строго меньший запас на
+// первом пути и нестрогий на втором), поэтому дерево остаётся сильно допустимым.
+// Возвращает false, если блокирует сама входящая дуга и базис не меняется
+bool MinCostFlowSolver::findLeavingArc() {
+    int first = arcSource[entering];
+    int second = arcTarget[entering];
+    if (arcState[entering] == kUpper) {
+        std::swap(first, second);
+    }
+
+    auto residual = [this](int e) {
+        return arcCapacity[e] == kInfiniteCapacity ? kInfiniteCapacity : arcCapacity[e] - arcFlow[e];
+    };
+
+    delta = arcCapacity[entering];
+    int result = 0;
+    for (int u = first; u != join; u = parent[u]) {
+        int e = pred[u];
+        std::int64_t d = predDirection[u] == kDown ? residual(e) : arcFlow[e];
+        if (d < delta) {
+            delta = d;
+            leavingNode = u;
+            result = 1;
+        }
+    }
+    for (int u = second; u != join; u = parent[u]) {
+        int e = pred[u];
+        std::int64_t d = predDirection[u] == kUp ? residual(e) : arcFlow[e];
+        if (d <= delta) {
+            delta = d;
+            leavingNode = u;
+            result = 2;
+        }
+    }
+
+    enteringInside = result == 1 ? first : second;
+    enteringOutside = result == 1 ? second : first;
+    return result != 0;
+}
+
+void MinCostFlowSolver::changeFlow(bool basisChanged) {
+    if (delta > 0) {
+        std::int64_t value = arcState[entering] * delta;
+        arcFlow[entering] += value;
+        for (int u = arcSource[entering]; u != join; u = parent[u]) {
+            arcFlow[pred[u]] -= predDirection[u] * value;
+        }
+        for (int u = arcTarget[entering]; u != join; u = parent[u]) {
+            arcFlow[pred[u]] += predDirection[u] * value;
+        }
+    }
+    if (basisChanged) {
+        int leaving = pred[leavingNode];
+        arcState[entering] = kTree;
+        arcState[leaving] = arcFlow[leaving] == 0 ? kLower : kUpper;
+    } else {
+        arcState[entering] = -arcState[entering];
+    }
+}
+
+// Поддерево leavingNode отрезается и подвешивается через входящую дугу: узлы пути от
+// enteringInside до leavingNode меняют родителя на предыдущий узел пути, затем
+// потенциалы и глубины поддерева сдвигаются одним обходом
+void MinCostFlowSolver::updateTree() {
+    int u = enteringInside;
+    int newParent = enteringOutside;
+    int newPred = entering;
+    signed char newDirection = u == arcSource[entering] ? kUp : kDown;
+    while (true) {
+        int oldParent = parent[u];
+        int oldPred = pred[u];
+        signed char oldDirection = predDirection[u];
+        detach(u, oldParent);
+        parent[u] = newParent;
+        pred[u] = newPred;
+        predDirection[u] = newDirection;
+        attach(u, newParent);
+        if (u == leavingNode) {
+            break;
+        }
+        newParent = u;
+        newPred = oldPred;
+        newDirection = -oldDirection;
+        u = oldParent;
+    }
+
+    double shift = potential[enteringOutside] - potential[enteringInside] -
+                   predDirection[enteringInside] * arcCost[entering];
+    stack.assign(1, enteringInside);
+    while (!stack.empty()) {
+        int x = stack.back();
+        stack.pop_back();
+        potential[x] += shift;
+        depth[x] = depth[parent[x]] + 1;
+        for (int c = firstChild[x]; c != -1; c = nextSibling[c]) {
+            stack.push_back(c);
+        }
+    }
+}
+
+FlowResult MinCostFlowSolver::solve(const double* cost) {
+    GRAPH_STAT_TIMER(flowSolveSeconds);
+    pivots = 0;
+    totalCost = 0.0;
+
+    double maxAbsCost = 0.0;
+    for (int a = 0; a < arcCount; a++) {
+        arcCost[a] = cost[a];
+        maxAbsCost = std::max(maxAbsCost, std::fabs(cost[a]));
+    }
+
+    if (!hasBasis) {
+        std::int64_t balance = 0;
+        for (int u = 0; u < nodeCount; u++) {
+            balance += supply[u];
+        }
+        if (balance != 0) {
+            return FlowResult::Infeasible;
+        }
+        initializeTree();
+        hasBasis = true;
+    }
+
+    // Искусственная дуга из корня дороже любого простого пути по дугам сети
+    double artificialCost = (maxAbsCost + 1.0) * (nodeCount + 1);
+    for (int u = 0; u < nodeCount; u++) {
+        int e = arcCount + u;
+        arcCost[e] = arcSource[e] == root ? artificialCost : 0.0;
+    }
+    potential[root] = 0.0;
+    depth[root] = 0;
+    computePotentials(root);
+
+    tolerance = 1e-9 * (1.0 + maxAbsCost);
+    blockSize = std::max(10, static_cast<int>(std::sqrt(static_cast<double>(arcCount))));
+    nextArc = std::min(nextArc, std::max(arcCount - 1, 0));
+
+    while (findEnteringArc()) {
+        findJoinNode();
+        bool basisChanged = findLeavingArc();
+        if (delta == kInfiniteCapacity) {
+            hasBasis = false;
+            return FlowResult::Unbounded;
+        }
+        changeFlow(basisChanged);
+        if (basisChanged) {
+            updateTree();
+            pivots++;
+            GRAPH_STAT_ADD(simplexPivots, 1);
+        }
+    }
+
+    for (int u = 0; u < nodeCount; u++) {
+        if (arcFlow[arcCount + u] != 0) {
+            return FlowResult::Infeasible;
+        }
+    }
+    for (int a = 0; a < arcCount; a++) {
+        totalCost += arcFlow[a] * arcCost[a];
+    }
+    return FlowResult::Optimal;
+}
+
+double MinCostFlowSolver::getTotalCost() const {
+    return totalCost;
+}
+
+std::int64_t MinCostFlowSolver::getFlow(int arc) const {
+    return arcFlow[arc];
+}
+
+double MinCostFlowSolver::getPotential(int node) const {
+    return potential[node];
+}
+
+int MinCostFlowSolver::getPivotCount() const {
+    return pivots;
+}
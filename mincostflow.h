@@ -0,0 +1,113 @@
+#ifndef MINCOSTFLOW_H
+#define MINCOSTFLOW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Итог решения задачи о потоке минимальной стоимости
+enum class FlowResult {
+    Optimal,
+    Infeasible,     // балансы узлов нельзя удовлетворить при заданных пропускных способностях
+    Unbounded       // есть цикл отрицательной стоимости бесконечной пропускной способности
+};
+
+// Пропускная способность, которая не ограничивает поток
+constexpr std::int64_t kInfiniteCapacity = std::numeric_limits<std::int64_t>::max();
+
+// Поток минимальной стоимости сетевым симплекс-методом
+//
+// Базис - остовное дерево на узлах сети и дополнительном корне; сначала оно состоит
+// из искусственных дуг между корнем и каждым узлом. Входящая дуга выбирается блочным
+// поиском (блоки около sqrt(m) дуг, поиск продолжается с места предыдущего), выходящая -
+// по правилу сильно допустимого дерева, что исключает зацикливание на вырожденных
+// шагах. Дерево хранится списками детей, поэтому шаг стоит O(длина цикла + размер
+// перевешиваемого поддерева).
+//
+// Дуги хранятся структурой массивов (концы, пропускные способности, поток, стоимость,
+// состояние) и просматриваются при поиске подряд. Базис сохраняется между вызовами
+// solve(): повторное решение той же сети с другими стоимостями начинается с прошлого
+// оптимального дерева (тёплый старт), а не с искусственного
+class MinCostFlowSolver {
+private:
+    int nodeCount;
+    int arcCount;
+    int root;
+
+    // Дуги 0 .. arcCount - 1 заданы сетью, дуга arcCount + u - искусственная между узлом u и корнем
+    std::vector<int> arcSource;
+    std::vector<int> arcTarget;
+    std::vector<std::int64_t> arcCapacity;
+    std::vector<std::int64_t> arcFlow;
+    std::vector<double> arcCost;
+    std::vector<signed char> arcState;
+    std::vector<std::int64_t> supply;
+
+    // Остовное дерево: родитель, дуга к родителю и её направление (1 - к родителю,
+    // -1 - от родителя), глубина и двусвязные списки детей
+    std::vector<int> parent;
+    std::vector<int> pred;
+    std::vector<signed char> predDirection;
+    std::vector<int> depth;
+    std::vector<int> firstChild;
+    std::vector<int> nextSibling;
+    std::vector<int> prevSibling;
+
+    // Потенциалы: приведённая стоимость дуги cost + potential[source] - potential[target]
+    // равна нулю на дугах дерева
+    std::vector<double> potential;
+    std::vector<int> stack;
+
+    bool hasBasis;
+    int blockSize;
+    int nextArc;
+    double tolerance;
+    double totalCost;
+    int pivots;
+
+    // Текущий шаг: входящая дуга, вершина пересечения путей до корня и выходящая дуга
+    // (дуга к родителю узла leaving в поддереве, которое перевешивается через entering)
+    int entering;
+    int join;
+    int leavingNode;
+    int enteringInside;
+    int enteringOutside;
+    std::int64_t delta;
+
+    void initializeTree();
+    void computePotentials(int from);
+    double reducedCost(int arc) const;
+    bool findEnteringArc();
+    void findJoinNode();
+    bool findLeavingArc();
+    void changeFlow(bool basisChanged);
+    void updateTree();
+    void attach(int child, int node);
+    void detach(int child, int node);
+
+public:
+    MinCostFlowSolver();
+
+    // Сеть из nodeCount узлов и arcCount дуг from[a] -> to[a] с пропускными способностями
+    // capacity[a] (kInfiniteCapacity - без ограничения); supply[v] > 0 - узел отдаёт
+    // поток, supply[v] < 0 - принимает. Сбрасывает базис
+    void setNetwork(int nodeCount, const int* from, const int* to, const std::int64_t* capacity,
+                    std::size_t arcCount, const std::int64_t* supply);
+
+    // Решение со стоимостями cost[a] (любого знака). После первого вызова для сети
+    // начинает с прошлого оптимального базиса
+    FlowResult solve(const double* cost);
+
+    double getTotalCost() const;
+    std::int64_t getFlow(int arc) const;
+
+    // Двойственная переменная узла: cost[a] + potential(from) - potential(to) >= 0 на дугах
+    // без потока, <= 0 на насыщенных и = 0 на остальных
+    double getPotential(int node) const;
+
+    // Число смен базиса при последнем вызове solve()
+    int getPivotCount() const;
+};
+
+#endif // MINCOSTFLOW_H
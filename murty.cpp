@@ -0,0 +1,358 @@
+#include "murty.h"
+#include "stats.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <utility>
+
+namespace {
+
+const double kNoPath = std::numeric_limits<double>::infinity();
+
+// Флаги столбца: занят закреплённой строкой, уже просмотрен текущим поиском
+const unsigned char kForcedColumn = 1;
+const unsigned char kScannedColumn = 2;
+
+// Подзадача разбиения Мурти вместе с её оптимальным назначением
+// Назначение хранится позициями рёбер в CSR (rowEdge), потенциалы u, v допустимы:
+// приведённая стоимость разрешённых рёбер неотрицательна и равна нулю на назначенных
+struct Subproblem {
+    double cost = 0.0;
+    std::vector<int> rowEdge;
+    std::vector<double> u;
+    std::vector<double> v;
+    std::vector<unsigned char> forcedRow;
+    std::vector<int> forbiddenEdges;
+    // Незакреплённые строки в порядке разбиения (заполняется при разбиении)
+    std::vector<int> order;
+};
+
+// Элемент очереди: решённая подзадача или ещё не решённый потомок position подзадачи node
+struct QueueEntry {
+    double key;
+    std::shared_ptr<Subproblem> node;
+    int position;
+
+    bool isSolved() const { return position < 0; }
+};
+
+// При равных ключах решённая подзадача идёт раньше потомка с той же оценкой
+struct EntryLater {
+    bool operator()(const QueueEntry& a, const QueueEntry& b) const {
+        if (a.key != b.key) {
+            return a.key > b.key;
+        }
+        return !a.isSolved() && b.isSolved();
+    }
+};
+
+class MurtySolver {
+private:
+    int n;
+    std::vector<int> offsets;
+    std::vector<int> edgeColumns;
+    std::vector<int> edgeRows;
+    std::vector<double> edgeCosts;
+    // Транспонированный CSR: позиции рёбер, входящих в столбец j, - columnEdges[columnOffsets[j] ..]
+    std::vector<int> columnOffsets;
+    std::vector<int> columnEdges;
+
+    // Ограничения текущей подзадачи: запрещённые рёбра и флаги столбцов. Через закрытый
+    // столбец (закреплённый или просмотренный) релаксация не идёт - одна проверка на ребро
+    std::vector<unsigned char> blockedEdge;
+    std::vector<unsigned char> closedColumn;
+
+    // Буферы поиска кратчайшего пути
+    std::vector<int> columnRow;
+    std::vector<double> distance;
+    std::vector<int> predecessor;
+    std::vector<int> touched;
+    // Двоичная куча (расстояние, столбец) на std::push_heap: память сохраняется между поисками
+    std::vector<std::pair<double, int>> heap;
+
+    void applyConstraints(const Subproblem& s, bool on);
+    void relaxRow(const Subproblem& s, int row, double base);
+    bool augment(Subproblem& s, int root);
+
+public:
+    MurtySolver(int n, const int* rows, const int* columns, const double* costs, std::size_t count);
+
+    std::shared_ptr<Subproblem> solveRoot();
+    std::shared_ptr<Subproblem> solveChild(const Subproblem& parent, int position);
+    void partition(Subproblem& s, std::vector<double>& bounds);
+    int columnOf(int edge) const { return edgeColumns[edge]; }
+};
+
+MurtySolver::MurtySolver(int n, const int* rows, const int* columns, const double* costs, std::size_t count)
+    : n(n), offsets(n + 1, 0), edgeColumns(count), edgeRows(count), edgeCosts(count),
+      columnOffsets(n + 1, 0), columnEdges(count), blockedEdge(count, 0), closedColumn(n, 0), columnRow(n, -1),
+      distance(n, kNoPath), predecessor(n, -1) {
+
+    for (std::size_t k = 0; k < count; k++) {
+        offsets[rows[k] + 1]++;
+    }
+    for (int i = 0; i < n; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (std::size_t k = 0; k < count; k++) {
+        int position = next[rows[k]]++;
+        edgeColumns[position] = columns[k];
+        edgeRows[position] = rows[k];
+        edgeCosts[position] = costs[k];
+        columnOffsets[columns[k] + 1]++;
+    }
+    for (int j = 0; j < n; j++) {
+        columnOffsets[j + 1] += columnOffsets[j];
+    }
+    next.assign(columnOffsets.begin(), columnOffsets.end() - 1);
+    for (std::size_t edge = 0; edge < count; edge++) {
+        columnEdges[next[edgeColumns[edge]]++] = edge;
+    }
+}
+
+// Отметка (on == true) или снятие ограничений подзадачи в общих буферах
+void MurtySolver::applyConstraints(const Subproblem& s, bool on) {
+    for (int edge : s.forbiddenEdges) {
+        blockedEdge[edge] = on;
+    }
+    for (int i = 0; i < n; i++) {
+        if (s.forcedRow[i] && s.rowEdge[i] != -1) {
+            closedColumn[edgeColumns[s.rowEdge[i]]] = on ? kForcedColumn : 0;
+        }
+    }
+}
+
+void MurtySolver::relaxRow(const Subproblem& s, int row, double base) {
+    double shift = base - s.u[row];
+    for (int k = offsets[row]; k < offsets[row + 1]; k++) {
+        int column = edgeColumns[k];
+        if (closedColumn[column] || blockedEdge[k]) {
+            continue;
+        }
+        double candidate = shift + edgeCosts[k] - s.v[column];
+        if (candidate < distance[column]) {
+            if (distance[column] == kNoPath) {
+                touched.push_back(column);
+            }
+            distance[column] = candidate;
+            predecessor[column] = k;
+            heap.push_back({candidate, column});
+            std::push_heap(heap.begin(), heap.end(), std::greater<std::pair<double, int>>());
+        }
+    }
+}
+
+// Кратчайший увеличивающий путь из свободной строки root до свободного столбца
+// Потенциалы сдвигаются на расстояния (ограниченные длиной пути D), после чего
+// рёбра пути имеют нулевую приведённую стоимость, а остальные - неотрицательную
+bool MurtySolver::augment(Subproblem& s, int root) {
+    GRAPH_STAT_ADD(bfsPhases, 1);
+    for (int i = 0; i < n; i++) {
+        if (s.rowEdge[i] != -1) {
+            columnRow[edgeColumns[s.rowEdge[i]]] = i;
+        }
+    }
+
+    relaxRow(s, root, 0.0);
+    int sink = -1;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<std::pair<double, int>>());
+        auto [d, column] = heap.back();
+        heap.pop_back();
+        if ((closedColumn[column] & kScannedColumn) || d > distance[column]) {
+            continue;
+        }
+        closedColumn[column] |= kScannedColumn;
+        GRAPH_STAT_ADD(edgesScanned, 1);
+        if (columnRow[column] == -1) {
+            sink = column;
+            break;
+        }
+        relaxRow(s, columnRow[column], d);
+    }
+
+    bool found = sink != -1;
+    if (found) {
+        GRAPH_STAT_ADD(augmentingPaths, 1);
+        double pathLength = distance[sink];
+        s.u[root] += pathLength;
+        for (int column : touched) {
+            if ((closedColumn[column] & kScannedColumn) && column != sink) {
+                s.v[column] += distance[column] - pathLength;
+                s.u[columnRow[column]] += pathLength - distance[column];
+            }
+        }
+
+        int column = sink;
+        while (true) {
+            int edge = predecessor[column];
+            int row = edgeRows[edge];
+            int previous = s.rowEdge[row];
+            s.rowEdge[row] = edge;
+            s.cost += edgeCosts[edge];
+            if (previous == -1) {
+                break;
+            }
+            s.cost -= edgeCosts[previous];
+            column = edgeColumns[previous];
+        }
+    }
+
+    for (int column : touched) {
+        distance[column] = kNoPath;
+        closedColumn[column] &= ~kScannedColumn;
+    }
+    touched.clear();
+    heap.clear();
+    std::fill(columnRow.begin(), columnRow.end(), -1);
+    return found;
+}
+
+// Исходная задача: v - минимум столбца, u = 0, затем по пути на каждую строку
+std::shared_ptr<Subproblem> MurtySolver::solveRoot() {
+    auto s = std::make_shared<Subproblem>();
+    s->rowEdge.assign(n, -1);
+    s->u.assign(n, 0.0);
+    s->v.assign(n, kNoPath);
+    s->forcedRow.assign(n, 0);
+    for (std::size_t k = 0; k < edgeCosts.size(); k++) {
+        s->v[edgeColumns[k]] = std::min(s->v[edgeColumns[k]], edgeCosts[k]);
+    }
+    for (int j = 0; j < n; j++) {
+        if (s->v[j] == kNoPath) {
+            return nullptr;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        if (!augment(*s, i)) {
+            return nullptr;
+        }
+    }
+    return s;
+}
+
+// Потомок position: строки order[0 .. position - 1] закреплены за своими столбцами,
+// назначенное ребро строки order[position] запрещено. Назначение и потенциалы родителя
+// остаются допустимыми, поэтому достаточно заново назначить одну строку
+std::shared_ptr<Subproblem> MurtySolver::solveChild(const Subproblem& parent, int position) {
+    auto s = std::make_shared<Subproblem>();
+    s->cost = parent.cost;
+    s->rowEdge = parent.rowEdge;
+    s->u = parent.u;
+    s->v = parent.v;
+    s->forcedRow = parent.forcedRow;
+    s->forbiddenEdges = parent.forbiddenEdges;
+    for (int t = 0; t < position; t++) {
+        s->forcedRow[parent.order[t]] = 1;
+    }
+    int row = parent.order[position];
+    s->forbiddenEdges.push_back(parent.rowEdge[row]);
+    s->cost -= edgeCosts[parent.rowEdge[row]];
+    s->rowEdge[row] = -1;
+
+    applyConstraints(*s, true);
+    bool found = augment(*s, row);
+    applyConstraints(*s, false);
+    return found ? s : nullptr;
+}
+
+// Порядок разбиения: незакреплённые строки по убыванию нижней оценки прироста стоимости.
+// Потомок, запретивший ребро (i, j), назначает строке i другое ребро, а столбцу j -
+// другую строку; это два разных ребра с неотрицательными приведёнными стоимостями,
+// поэтому прирост не меньше суммы наименьших альтернатив по строке и по столбцу.
+// bounds[t] - нижняя оценка стоимости потомка t (kNoPath, если альтернативы нет)
+void MurtySolver::partition(Subproblem& s, std::vector<double>& bounds) {
+    applyConstraints(s, true);
+    std::vector<std::pair<double, int>> slack;
+    for (int i = 0; i < n; i++) {
+        if (s.forcedRow[i]) {
+            continue;
+        }
+        int assigned = s.rowEdge[i];
+        int column = edgeColumns[assigned];
+        double rowBest = kNoPath;
+        for (int k = offsets[i]; k < offsets[i + 1]; k++) {
+            if (k == assigned || blockedEdge[k] || closedColumn[edgeColumns[k]]) {
+                continue;
+            }
+            rowBest = std::min(rowBest, edgeCosts[k] - s.u[i] - s.v[edgeColumns[k]]);
+        }
+        double columnBest = kNoPath;
+        for (int p = columnOffsets[column]; p < columnOffsets[column + 1]; p++) {
+            int k = columnEdges[p];
+            int row = edgeRows[k];
+            if (k == assigned || blockedEdge[k] || s.forcedRow[row]) {
+                continue;
+            }
+            columnBest = std::min(columnBest, edgeCosts[k] - s.u[row] - s.v[column]);
+        }
+        slack.push_back({std::max(rowBest, 0.0) + std::max(columnBest, 0.0), i});
+    }
+    applyConstraints(s, false);
+
+    std::sort(slack.begin(), slack.end(), std::greater<std::pair<double, int>>());
+    s.order.clear();
+    bounds.clear();
+    for (auto [value, row] : slack) {
+        s.order.push_back(row);
+        bounds.push_back(s.cost + value);
+    }
+}
+
+}
+
+std::vector<RankedAssignment> findKBestAssignments(int n, const int* rows, const int* columns,
+                                                   const double* costs, std::size_t count, int k) {
+    GRAPH_STAT_TIMER(assignmentSolveSeconds);
+    std::vector<RankedAssignment> result;
+    if (k <= 0) {
+        return result;
+    }
+    if (n == 0) {
+        result.push_back(RankedAssignment());
+        return result;
+    }
+
+    MurtySolver solver(n, rows, columns, costs, count);
+    std::shared_ptr<Subproblem> root = solver.solveRoot();
+    if (!root) {
+        return result;
+    }
+
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, EntryLater> queue;
+    queue.push({root->cost, root, -1});
+    std::vector<double> bounds;
+
+    while (!queue.empty() && static_cast<int>(result.size()) < k) {
+        QueueEntry entry = queue.top();
+        queue.pop();
+
+        if (!entry.isSolved()) {
+            std::shared_ptr<Subproblem> child = solver.solveChild(*entry.node, entry.position);
+            if (child) {
+                queue.push({child->cost, child, -1});
+            }
+            continue;
+        }
+
+        Subproblem& s = *entry.node;
+        RankedAssignment ranked;
+        ranked.cost = s.cost;
+        ranked.assignment.resize(n);
+        for (int i = 0; i < n; i++) {
+            ranked.assignment[i] = solver.columnOf(s.rowEdge[i]);
+        }
+        result.push_back(std::move(ranked));
+
+        solver.partition(s, bounds);
+        for (int t = 0; t < static_cast<int>(bounds.size()); t++) {
+            if (bounds[t] != kNoPath) {
+                queue.push({bounds[t], entry.node, t});
+            }
+        }
+    }
+    return result;
+}
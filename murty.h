@@ -0,0 +1,26 @@
+#ifndef MURTY_H
+#define MURTY_H
+
+#include <cstddef>
+#include <vector>
+
+// Одно назначение из ранжированного списка: стоимость и столбец каждой строки
+struct RankedAssignment {
+    double cost = 0.0;
+    std::vector<int> assignment;
+};
+
+// k назначений наименьшей стоимости по возрастанию (алгоритм Мурти) для разреженной
+// задачи n x n: count различных пар (rows[k], columns[k]) со стоимостями costs[k].
+// Если совершенных назначений меньше k, возвращаются все; если их нет - пустой список.
+//
+// Подзадачи решаются кратчайшими увеличивающими путями (Дейкстра по приведённым
+// стоимостям). Потомок наследует назначение и потенциалы родителя, поэтому его решение -
+// один увеличивающий путь из освобождённой строки. Строки разбиваются по убыванию
+// наименьшей альтернативной приведённой стоимости, а потомки кладутся в очередь с нижней
+// оценкой (стоимость родителя плюс эта альтернатива) и решаются, только когда доходят до
+// её начала
+std::vector<RankedAssignment> findKBestAssignments(int n, const int* rows, const int* columns,
+                                                   const double* costs, std::size_t count, int k);
+
+#endif // MURTY_H
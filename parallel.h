@@ -0,0 +1,79 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// Число потоков: threads, а при threads <= 0 - по числу аппаратных потоков
+inline int resolveThreads(int threads) {
+    if (threads > 0) {
+        return threads;
+    }
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? static_cast<int>(hardware) : 1;
+}
+
+// Число потоков, которые получат блоки при chunkCount блоках
+inline int chunkWorkers(std::size_t chunkCount, int threads) {
+    return static_cast<int>(std::min<std::size_t>(resolveThreads(threads), std::max<std::size_t>(chunkCount, 1)));
+}
+
+// Выполнение body(chunk, worker) для всех блоков 0 .. chunkCount - 1 на нескольких потоках
+// Потоки разбирают блоки через общий атомарный счётчик; worker - номер потока
+// от 0 до chunkWorkers(chunkCount, threads) - 1, по нему удобно выбирать рабочий буфер
+template <typename Body>
+void forEachChunkIndexed(std::size_t chunkCount, int threads, Body body) {
+    int workers = chunkWorkers(chunkCount, threads);
+    if (workers <= 1) {
+        for (std::size_t chunk = 0; chunk < chunkCount; chunk++) {
+            body(chunk, 0);
+        }
+        return;
+    }
+
+    // Исключение из body запоминается, остальные потоки перестают брать блоки;
+    // после ожидания всех потоков первое исключение передаётся вызывающему
+    std::atomic<std::size_t> nextChunk(0);
+    std::vector<std::exception_ptr> errors(workers);
+    auto worker = [&](int index) {
+        try {
+            for (std::size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                body(chunk, index);
+            }
+        } catch (...) {
+            errors[index] = std::current_exception();
+            nextChunk = chunkCount;
+        }
+    };
+
+    // Если поток создать не удалось, его блоки разбирают уже запущенные
+    std::vector<std::thread> pool;
+    try {
+        pool.reserve(workers - 1);
+        for (int t = 1; t < workers; t++) {
+            pool.emplace_back(worker, t);
+        }
+    } catch (...) {
+        // работают уже созданные потоки и вызывающий
+    }
+    worker(0);
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+template <typename Body>
+void forEachChunk(std::size_t chunkCount, int threads, Body body) {
+    forEachChunkIndexed(chunkCount, threads, [&](std::size_t chunk, int) { body(chunk); });
+}
+
+#endif // PARALLEL_H
@@ -0,0 +1,289 @@
+#include "parallelmatching.h"
+#include "parallel.h"
+#include "stats.h"
+#include <algorithm>
+
+namespace {
+
+// Вершин фронта в одном блоке: меньший фронт обрабатывается без запуска потоков
+const std::size_t kChunk = 512;
+
+// Прививка выгоднее перестроения леса, если вершин в живых деревьях не меньше
+// 1 / kGraftRatio от числа освобождённых вершин второй доли
+const std::size_t kGraftRatio = 4;
+
+std::size_t chunkCount(std::size_t size) {
+    return (size + kChunk - 1) / kChunk;
+}
+
+}
+
+ParallelBipartiteMatcher::ParallelBipartiteMatcher(int threads)
+    : threads(threads), n(0), phases(0), capacity(0) {}
+
+void ParallelBipartiteMatcher::reserve(int n) {
+    if (capacity < static_cast<std::size_t>(n)) {
+        claim.reset(new std::atomic<int>[n]);
+        rootOf.reset(new std::atomic<int>[n]);
+        leaf.reset(new std::atomic<int>[n]);
+        capacity = n;
+    }
+    parent.resize(n);
+    forEachChunk(chunkCount(n), threads, [&](std::size_t chunk) {
+        int end = std::min<std::size_t>(n, (chunk + 1) * kChunk);
+        for (int v = chunk * kChunk; v < end; v++) {
+            claim[v].store(-1, std::memory_order_relaxed);
+            rootOf[v].store(-1, std::memory_order_relaxed);
+            leaf[v].store(-1, std::memory_order_relaxed);
+        }
+    });
+
+    int workers = resolveThreads(threads);
+    nextFirst.resize(workers);
+    nextSecond.resize(workers);
+}
+
+// Жадное паросочетание: вершина первой доли берёт первого свободного соседа,
+// захватывая его сравнением с обменом. Захваты затем сбрасываются
+void ParallelBipartiteMatcher::greedy(const int* offsets, const int* targets, const int* side, int* match) {
+    forEachChunk(chunkCount(n), threads, [&](std::size_t chunk) {
+        int end = std::min<std::size_t>(n, (chunk + 1) * kChunk);
+        for (int x = chunk * kChunk; x < end; x++) {
+            if (side[x] != 0) {
+                continue;
+            }
+            for (int k = offsets[x]; k < offsets[x + 1]; k++) {
+                int y = targets[k];
+                int expected = -1;
+                if (side[y] == 1 && claim[y].load(std::memory_order_relaxed) == -1 &&
+                    claim[y].compare_exchange_strong(expected, x, std::memory_order_relaxed)) {
+                    match[x] = y;
+                    match[y] = x;
+                    break;
+                }
+            }
+        }
+    });
+    forEachChunk(chunkCount(n), threads, [&](std::size_t chunk) {
+        int end = std::min<std::size_t>(n, (chunk + 1) * kChunk);
+        for (int v = chunk * kChunk; v < end; v++) {
+            claim[v].store(-1, std::memory_order_relaxed);
+        }
+    });
+}
+
+// Перенос найденного потоками уровня в общий фронт и списки вершин леса
+void ParallelBipartiteMatcher::collect() {
+    frontier.clear();
+    for (std::size_t w = 0; w < nextFirst.size(); w++) {
+        frontier.insert(frontier.end(), nextFirst[w].begin(), nextFirst[w].end());
+        treeSecond.insert(treeSecond.end(), nextSecond[w].begin(), nextSecond[w].end());
+        nextFirst[w].clear();
+        nextSecond[w].clear();
+    }
+    treeFirst.insert(treeFirst.end(), frontier.begin(), frontier.end());
+}
+
+// Поиск в ширину по уровням до исчерпания фронта
+// Соседа захватывает одно дерево; дерево с найденным путём дальше не растёт
+void ParallelBipartiteMatcher::grow(const int* offsets, const int* targets, const int* side, const int* match) {
+    while (!frontier.empty()) {
+        forEachChunkIndexed(chunkCount(frontier.size()), threads, [&](std::size_t chunk, int worker) {
+            std::vector<int>& next = nextFirst[worker];
+            std::vector<int>& claimed = nextSecond[worker];
+            std::size_t end = std::min(frontier.size(), (chunk + 1) * kChunk);
+            for (std::size_t i = chunk * kChunk; i < end; i++) {
+                int x = frontier[i];
+                int r = rootOf[x].load(std::memory_order_relaxed);
+                if (leaf[r].load(std::memory_order_relaxed) != -1) {
+                    continue;
+                }
+                for (int k = offsets[x]; k < offsets[x + 1]; k++) {
+                    int y = targets[k];
+                    int expected = -1;
+                    if (side[y] != 1 || claim[y].load(std::memory_order_relaxed) != -1 ||
+                        !claim[y].compare_exchange_strong(expected, r, std::memory_order_relaxed)) {
+                        continue;
+                    }
+                    parent[y] = x;
+                    claimed.push_back(y);
+                    int mate = match[y];
+                    if (mate == -1) {
+                        int none = -1;
+                        leaf[r].compare_exchange_strong(none, y, std::memory_order_relaxed);
+                        break;
+                    }
+                    rootOf[mate].store(r, std::memory_order_relaxed);
+                    next.push_back(mate);
+                }
+            }
+        });
+        collect();
+    }
+}
+
+// Увеличение вдоль путей всех деревьев с найденной свободной вершиной
+// Деревья не пересекаются, поэтому пути обрабатываются параллельно без синхронизации
+int ParallelBipartiteMatcher::augment(int* match) {
+    augmentedRoots.clear();
+    std::size_t kept = 0;
+    for (int r : roots) {
+        if (leaf[r].load(std::memory_order_relaxed) != -1) {
+            augmentedRoots.push_back(r);
+        } else {
+            roots[kept++] = r;
+        }
+    }
+    roots.resize(kept);
+
+    forEachChunk(chunkCount(augmentedRoots.size()), threads, [&](std::size_t chunk) {
+        std::size_t end = std::min(augmentedRoots.size(), (chunk + 1) * kChunk);
+        for (std::size_t i = chunk * kChunk; i < end; i++) {
+            int r = augmentedRoots[i];
+            int y = leaf[r].load(std::memory_order_relaxed);
+            while (true) {
+                int x = parent[y];
+                int next = match[x];
+                match[x] = y;
+                match[y] = x;
+                if (x == r) {
+                    break;
+                }
+                y = next;
+            }
+        }
+    });
+    return augmentedRoots.size();
+}
+
+// Новый лес из оставшихся свободных вершин первой доли
+void ParallelBipartiteMatcher::rebuild() {
+    for (int x : treeFirst) {
+        rootOf[x].store(-1, std::memory_order_relaxed);
+    }
+    for (int y : treeSecond) {
+        claim[y].store(-1, std::memory_order_relaxed);
+    }
+    for (int r : augmentedRoots) {
+        leaf[r].store(-1, std::memory_order_relaxed);
+    }
+    for (int r : roots) {
+        rootOf[r].store(r, std::memory_order_relaxed);
+        leaf[r].store(-1, std::memory_order_relaxed);
+    }
+    treeFirst = roots;
+    treeSecond.clear();
+    frontier = roots;
+}
+
+// Живые деревья (без пути) сохраняются: они уже исчерпали своих соседей, кроме вершин
+// отработавших деревьев. Эти вершины второй доли освобождаются, и каждая, у которой
+// есть сосед в живом дереве, прививается к нему; её партнёр попадает в новый фронт
+void ParallelBipartiteMatcher::graft(const int* offsets, const int* targets, const int* side, const int* match) {
+    std::size_t kept = 0;
+    for (int x : treeFirst) {
+        int r = rootOf[x].load(std::memory_order_relaxed);
+        if (leaf[r].load(std::memory_order_relaxed) == -1) {
+            treeFirst[kept++] = x;
+        } else {
+            rootOf[x].store(-1, std::memory_order_relaxed);
+        }
+    }
+    treeFirst.resize(kept);
+
+    kept = 0;
+    renewable.clear();
+    for (int y : treeSecond) {
+        int r = claim[y].load(std::memory_order_relaxed);
+        if (leaf[r].load(std::memory_order_relaxed) == -1) {
+            treeSecond[kept++] = y;
+        } else {
+            claim[y].store(-1, std::memory_order_relaxed);
+            renewable.push_back(y);
+        }
+    }
+    treeSecond.resize(kept);
+    for (int r : augmentedRoots) {
+        leaf[r].store(-1, std::memory_order_relaxed);
+    }
+
+    forEachChunkIndexed(chunkCount(renewable.size()), threads, [&](std::size_t chunk, int worker) {
+        std::vector<int>& next = nextFirst[worker];
+        std::vector<int>& claimed = nextSecond[worker];
+        std::size_t end = std::min(renewable.size(), (chunk + 1) * kChunk);
+        for (std::size_t i = chunk * kChunk; i < end; i++) {
+            int y = renewable[i];
+            for (int k = offsets[y]; k < offsets[y + 1]; k++) {
+                int x = targets[k];
+                if (side[x] != 0) {
+                    continue;
+                }
+                int r = rootOf[x].load(std::memory_order_relaxed);
+                if (r == -1 || leaf[r].load(std::memory_order_relaxed) != -1) {
+                    continue;
+                }
+                claim[y].store(r, std::memory_order_relaxed);
+                parent[y] = x;
+                claimed.push_back(y);
+                int mate = match[y];
+                if (mate == -1) {
+                    int none = -1;
+                    leaf[r].compare_exchange_strong(none, y, std::memory_order_relaxed);
+                } else {
+                    rootOf[mate].store(r, std::memory_order_relaxed);
+                    next.push_back(mate);
+                }
+                break;
+            }
+        }
+    });
+    collect();
+}
+
+void ParallelBipartiteMatcher::solve(int n, const int* offsets, const int* targets, const int* side, int* match) {
+    this->n = n;
+    phases = 0;
+    reserve(n);
+    std::fill(match, match + n, -1);
+    greedy(offsets, targets, side, match);
+
+    roots.clear();
+    for (int x = 0; x < n; x++) {
+        if (side[x] == 0 && match[x] == -1) {
+            roots.push_back(x);
+        }
+    }
+    treeFirst.clear();
+    treeSecond.clear();
+    augmentedRoots.clear();
+    rebuild();
+
+    while (true) {
+        phases++;
+        GRAPH_STAT_ADD(bfsPhases, 1);
+        grow(offsets, targets, side, match);
+        int found = augment(match);
+        GRAPH_STAT_ADD(augmentingPaths, found);
+        if (found == 0) {
+            break;
+        }
+
+        std::size_t active = 0;
+        for (int x : treeFirst) {
+            active += leaf[rootOf[x].load(std::memory_order_relaxed)].load(std::memory_order_relaxed) == -1;
+        }
+        std::size_t released = 0;
+        for (int y : treeSecond) {
+            released += leaf[claim[y].load(std::memory_order_relaxed)].load(std::memory_order_relaxed) != -1;
+        }
+        if (active * kGraftRatio >= released) {
+            graft(offsets, targets, side, match);
+        } else {
+            rebuild();
+        }
+    }
+}
+
+int ParallelBipartiteMatcher::getPhaseCount() const {
+    return phases;
+}
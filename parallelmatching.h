@@ -0,0 +1,69 @@
+#ifndef PARALLELMATCHING_H
+#define PARALLELMATCHING_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Параллельное максимальное паросочетание двудольного графа в духе MS-BFS-Graft
+//
+// Фаза - поиск в ширину по уровням сразу из всех свободных вершин первой доли: каждая
+// растит своё чередующееся дерево, вершины второй доли захватываются атомарным
+// сравнением с обменом, поэтому деревья не пересекаются. Дерево, дошедшее до свободной
+// вершины, перестаёт расти; найденные пути не пересекаются и увеличиваются параллельно
+// без блокировок. Между фазами деревья без пути сохраняются: вершины отработавших
+// деревьев освобождаются и прививаются к ним (grafting), если живые деревья велики,
+// иначе лес строится заново от свободных вершин. Фаза без путей означает максимальность.
+//
+// Начальное паросочетание - параллельное жадное. Уровни с малым фронтом и прививка
+// малых множеств выполняются в вызывающем потоке без запуска потоков.
+// Буферы сохраняются между вызовами solve()
+class ParallelBipartiteMatcher {
+private:
+    int threads;
+    int n;
+    int phases;
+
+    // Вторая доля: корень захватившего дерева (-1 - свободна) и вершина-родитель
+    // Первая доля: корень дерева (-1 - вне леса). Корень: найденная свободная вершина
+    // второй доли, которой заканчивается путь (-1 - пути нет)
+    std::unique_ptr<std::atomic<int>[]> claim;
+    std::unique_ptr<std::atomic<int>[]> rootOf;
+    std::unique_ptr<std::atomic<int>[]> leaf;
+    std::vector<int> parent;
+    std::size_t capacity;
+
+    // Корни, корни деревьев с найденным путём, фронт, вершины леса по долям,
+    // освобождённые для прививки вершины и рабочие буферы потоков
+    std::vector<int> roots;
+    std::vector<int> augmentedRoots;
+    std::vector<int> frontier;
+    std::vector<int> treeFirst;
+    std::vector<int> treeSecond;
+    std::vector<int> renewable;
+    std::vector<std::vector<int>> nextFirst;
+    std::vector<std::vector<int>> nextSecond;
+
+    void reserve(int n);
+    void greedy(const int* offsets, const int* targets, const int* side, int* match);
+    void grow(const int* offsets, const int* targets, const int* side, const int* match);
+    int augment(int* match);
+    void rebuild();
+    void graft(const int* offsets, const int* targets, const int* side, const int* match);
+    void collect();
+
+public:
+    // threads <= 0 - по числу аппаратных потоков
+    explicit ParallelBipartiteMatcher(int threads = 0);
+
+    // Граф в формате CSR: соседи вершины v - targets[offsets[v] .. offsets[v + 1]),
+    // side[v] - доля (0 или 1), рёбра соединяют разные доли. В match[v] записывается
+    // партнёр вершины или -1
+    void solve(int n, const int* offsets, const int* targets, const int* side, int* match);
+
+    // Число фаз поиска при последнем вызове solve()
+    int getPhaseCount() const;
+};
+
+#endif // PARALLELMATCHING_H
@@ -0,0 +1,44 @@
+#include "parsing.h"
+#include <charconv>
+
+namespace {
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+}
+
+// Выделение следующего слова, разделённого пробельными символами
+// text сдвигается за прочитанное слово; false, если слов больше нет
+bool nextToken(std::string_view& text, std::string_view& token) noexcept {
+    std::size_t begin = 0;
+    while (begin < text.size() && isSpace(text[begin])) {
+        begin++;
+    }
+    std::size_t end = begin;
+    while (end < text.size() && !isSpace(text[end])) {
+        end++;
+    }
+    token = text.substr(begin, end - begin);
+    text.remove_prefix(end);
+    return !token.empty();
+}
+
+bool parseInt(std::string_view token, int& value) noexcept {
+    const char* first = token.data();
+    const char* last = token.data() + token.size();
+    if (first != last && *first == '+') {
+        first++;
+    }
+    auto result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last && first != last;
+}
+
+bool parseDouble(std::string_view token, double& value) noexcept {
+    const char* first = token.data();
+    const char* last = token.data() + token.size();
+    if (first != last && *first == '+') {
+        first++;
+    }
+    auto result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last && first != last;
+}
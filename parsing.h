@@ -0,0 +1,11 @@
+#ifndef PARSING_H
+#define PARSING_H
+
+#include <string_view>
+
+// Разбор текстовых строк без исключений и без выделения памяти
+bool nextToken(std::string_view& text, std::string_view& token) noexcept;
+bool parseInt(std::string_view token, int& value) noexcept;
+bool parseDouble(std::string_view token, double& value) noexcept;
+
+#endif // PARSING_H
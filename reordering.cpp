@@ -0,0 +1,146 @@
+#include "reordering.h"
+#include <algorithm>
+
+namespace {
+
+int degreeOf(const int* offsets, int v) {
+    return offsets[v + 1] - offsets[v];
+}
+
+// Вершины по убыванию степени подсчётом; при равной степени сохраняется исходный порядок
+void degreeOrder(int n, const int* offsets, std::vector<int>& result) {
+    int maxDegree = 0;
+    for (int v = 0; v < n; v++) {
+        maxDegree = std::max(maxDegree, degreeOf(offsets, v));
+    }
+    std::vector<int> start(maxDegree + 2, 0);
+    for (int v = 0; v < n; v++) {
+        start[maxDegree - degreeOf(offsets, v) + 1]++;
+    }
+    for (int d = 0; d <= maxDegree; d++) {
+        start[d + 1] += start[d];
+    }
+    result.resize(n);
+    for (int v = 0; v < n; v++) {
+        result[start[maxDegree - degreeOf(offsets, v)]++] = v;
+    }
+}
+
+void breadthFirstOrder(int n, const int* offsets, const int* targets, std::vector<int>& result) {
+    std::vector<unsigned char> visited(n, 0);
+    result.clear();
+    result.reserve(n);
+    for (int s = 0; s < n; s++) {
+        if (visited[s]) {
+            continue;
+        }
+        visited[s] = 1;
+        std::size_t head = result.size();
+        result.push_back(s);
+        while (head < result.size()) {
+            int v = result[head++];
+            for (int k = offsets[v]; k < offsets[v + 1]; k++) {
+                int u = targets[k];
+                if (!visited[u]) {
+                    visited[u] = 1;
+                    result.push_back(u);
+                }
+            }
+        }
+    }
+}
+
+// Псевдопериферийная вершина по Джорджу-Лю: обход в ширину повторяется от вершины
+// наименьшей степени на последнем уровне, пока растёт эксцентриситет.
+// Обходы метят вершины числом stamp, не задевая пометок основного обхода
+int peripheralVertex(int start, const int* offsets, const int* targets, std::vector<int>& seen, int& stamp,
+                     std::vector<int>& queue) {
+    int eccentricity = -1;
+    while (true) {
+        stamp++;
+        queue.assign(1, start);
+        seen[start] = stamp;
+        std::size_t head = 0;
+        std::size_t levelStart = 0;
+        int levels = 0;
+        while (head < queue.size()) {
+            std::size_t levelEnd = queue.size();
+            levelStart = head;
+            for (; head < levelEnd; head++) {
+                int v = queue[head];
+                for (int k = offsets[v]; k < offsets[v + 1]; k++) {
+                    int u = targets[k];
+                    if (seen[u] != stamp) {
+                        seen[u] = stamp;
+                        queue.push_back(u);
+                    }
+                }
+            }
+            levels++;
+        }
+        if (levels <= eccentricity) {
+            return start;
+        }
+        eccentricity = levels;
+
+        int best = queue[levelStart];
+        for (std::size_t i = levelStart; i < queue.size(); i++) {
+            if (degreeOf(offsets, queue[i]) < degreeOf(offsets, best)) {
+                best = queue[i];
+            }
+        }
+        if (best == start) {
+            return start;
+        }
+        start = best;
+    }
+}
+
+// Обход Катхилла-Макки: компоненты начинаются с псевдопериферийной вершины, соседи
+// добавляются по возрастанию степени. Обращённый порядок уменьшает ширину ленты
+void reverseCuthillMcKeeOrder(int n, const int* offsets, const int* targets, std::vector<int>& result) {
+    std::vector<int> byDegree;
+    degreeOrder(n, offsets, byDegree);
+    std::reverse(byDegree.begin(), byDegree.end());
+
+    std::vector<unsigned char> visited(n, 0);
+    std::vector<int> seen(n, 0);
+    std::vector<int> queue;
+    int stamp = 0;
+    result.clear();
+    result.reserve(n);
+    for (int s : byDegree) {
+        if (visited[s]) {
+            continue;
+        }
+        int root = peripheralVertex(s, offsets, targets, seen, stamp, queue);
+        visited[root] = 1;
+        std::size_t head = result.size();
+        result.push_back(root);
+        while (head < result.size()) {
+            int v = result[head++];
+            std::size_t first = result.size();
+            for (int k = offsets[v]; k < offsets[v + 1]; k++) {
+                int u = targets[k];
+                if (!visited[u]) {
+                    visited[u] = 1;
+                    result.push_back(u);
+                }
+            }
+            std::stable_sort(result.begin() + first, result.end(), [offsets](int a, int b) {
+                return degreeOf(offsets, a) < degreeOf(offsets, b);
+            });
+        }
+    }
+    std::reverse(result.begin(), result.end());
+}
+
+}
+
+void computeVertexOrder(VertexOrder order, int n, const int* offsets, const int* targets, std::vector<int>& result) {
+    switch (order) {
+        case VertexOrder::Degree: degreeOrder(n, offsets, result); break;
+        case VertexOrder::BreadthFirst: breadthFirstOrder(n, offsets, targets, result); break;
+        case VertexOrder::ReverseCuthillMcKee: reverseCuthillMcKeeOrder(n, offsets, targets, result); break;
+    }
+}
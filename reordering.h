@@ -0,0 +1,20 @@
+#ifndef REORDERING_H
+#define REORDERING_H
+
+#include <vector>
+
+// Перенумерация вершин для локальности обхода
+// Вершины, соседние в графе, получают близкие плотные индексы, поэтому обход в ширину
+// и поиск путей читают массивы по соседним адресам, а не по всей памяти
+enum class VertexOrder {
+    Degree,                 // по убыванию степени: вершины-хабы и их данные рядом в начале
+    BreadthFirst,           // порядок обхода в ширину от вершины с меньшим индексом в каждой компоненте
+    ReverseCuthillMcKee     // обход в ширину от псевдопериферийной вершины с соседями по
+                            // возрастанию степени, затем обращение - минимизирует ширину ленты
+};
+
+// Порядок вершин графа в формате CSR (соседи v - targets[offsets[v] .. offsets[v + 1])):
+// в result[k] записывается старый индекс вершины, которая получит индекс k
+void computeVertexOrder(VertexOrder order, int n, const int* offsets, const int* targets, std::vector<int>& result);
+
+#endif // REORDERING_H
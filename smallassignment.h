@@ -0,0 +1,123 @@
+#ifndef SMALLASSIGNMENT_H
+#define SMALLASSIGNMENT_H
+
+#include <array>
+#include <limits>
+#include <type_traits>
+
+// Венгерский алгоритм для задач размера N <= 16, известного при компиляции
+// Все буферы - std::array на стеке, циклы имеют постоянные границы и разворачиваются
+// компилятором, обновление потенциалов выполняется без ветвлений.
+// T - тип стоимостей (int32_t, float, double); для целых типов сумма стоимостей
+// назначения не должна превышать std::numeric_limits<T>::max() / 4
+constexpr int kSmallAssignmentMax = 16;
+
+template <typename T>
+constexpr T smallAssignmentInfinity() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::max() / 2;
+    }
+}
+
+// cost - матрица N x N по строкам; в assignment[i] записывается столбец строки i
+// Возвращается стоимость назначения. Если переданы rowPotential и columnPotential,
+// в них записываются двойственные переменные: cost[i][j] - u[i] - v[j] >= 0, и равенство
+// на парах назначения
+template <int N, typename T>
+T solveSmallAssignment(const T* cost, int* assignment, T* rowPotential = nullptr, T* columnPotential = nullptr) {
+    static_assert(N >= 1 && N <= kSmallAssignmentMax, "размер задачи вне диапазона малых ядер");
+    static_assert(std::is_arithmetic<T>::value, "стоимость должна быть числом");
+    constexpr T INF = smallAssignmentInfinity<T>();
+
+    std::array<T, N + 1> u{};
+    std::array<T, N + 1> v{};
+    std::array<int, N + 1> p{};
+    std::array<int, N + 1> way{};
+
+    for (int i = 1; i <= N; i++) {
+        std::array<T, N + 1> minv;
+        std::array<unsigned char, N + 1> used{};
+        minv.fill(INF);
+        p[0] = i;
+        int j0 = 0;
+
+        do {
+            used[j0] = 1;
+            int i0 = p[j0];
+            T delta = INF;
+            int j1 = 0;
+            const T* row = cost + (i0 - 1) * N;
+            const T ui = u[i0];
+
+            for (int j = 1; j <= N; j++) {
+                T cur = row[j - 1] - ui - v[j];
+                bool better = !used[j] && cur < minv[j];
+                minv[j] = better ? cur : minv[j];
+                way[j] = better ? j0 : way[j];
+                bool smallest = !used[j] && minv[j] < delta;
+                delta = smallest ? minv[j] : delta;
+                j1 = smallest ? j : j1;
+            }
+
+            for (int j = 0; j <= N; j++) {
+                T step = used[j] ? delta : T(0);
+                u[p[j]] += step;
+                v[j] -= step;
+                minv[j] -= used[j] ? T(0) : delta;
+            }
+
+            j0 = j1;
+        } while (p[j0] != 0);
+
+        do {
+            int j1 = way[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while (j0);
+    }
+
+    T total = 0;
+    for (int j = 1; j <= N; j++) {
+        assignment[p[j] - 1] = j - 1;
+        total += cost[(p[j] - 1) * N + (j - 1)];
+    }
+    if (rowPotential && columnPotential) {
+        for (int k = 1; k <= N; k++) {
+            rowPotential[k - 1] = u[k];
+            columnPotential[k - 1] = v[k];
+        }
+    }
+    return total;
+}
+
+namespace detail {
+
+template <typename T, int N>
+bool dispatchSmallAssignment(int n, const T* cost, int* assignment, T& total, T* rowPotential, T* columnPotential) {
+    if constexpr (N > kSmallAssignmentMax) {
+        return false;
+    } else {
+        if (n == N) {
+            total = solveSmallAssignment<N, T>(cost, assignment, rowPotential, columnPotential);
+            return true;
+        }
+        return dispatchSmallAssignment<T, N + 1>(n, cost, assignment, total, rowPotential, columnPotential);
+    }
+}
+
+}
+
+// Выбор ядра по размеру во время выполнения
+// Возвращает false, если для размера n специализированного ядра нет
+template <typename T>
+bool solveSmallAssignment(int n, const T* cost, int* assignment, T& total,
+                          T* rowPotential = nullptr, T* columnPotential = nullptr) {
+    if (n < 1 || n > kSmallAssignmentMax) {
+        return false;
+    }
+    return detail::dispatchSmallAssignment<T, 1>(n, cost, assignment, total, rowPotential, columnPotential);
+}
+
+#endif // SMALLASSIGNMENT_H
@@ -0,0 +1,31 @@
+#include "solveoptions.h"
+
+CancellationToken::CancellationToken() : flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+void CancellationToken::cancel() noexcept {
+    flag->store(true, std::memory_order_relaxed);
+}
+
+bool CancellationToken::isCancelled() const noexcept {
+    return flag->load(std::memory_order_relaxed);
+}
+
+SolveOptions SolveOptions::withTimeout(Clock::duration timeout) {
+    SolveOptions options;
+    options.deadline = Clock::now() + timeout;
+    return options;
+}
+
+// Пора ли прервать вычисление
+// Часы опрашиваются только если срок задан
+bool SolveOptions::shouldStop() const {
+    if (cancellation && cancellation->isCancelled()) {
+        return true;
+    }
+    return deadline != Clock::time_point::max() && Clock::now() >= deadline;
+}
+
+// Заданы ли срок, отмена или отслеживание хода вычисления
+bool SolveOptions::hasLimits() const {
+    return cancellation || progress || deadline != Clock::time_point::max();
+}
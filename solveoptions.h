@@ -0,0 +1,44 @@
+#ifndef SOLVEOPTIONS_H
+#define SOLVEOPTIONS_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+
+// Флаг отмены, общий для всех копий токена
+// Копию можно передать в другой поток и вызвать cancel() оттуда
+class CancellationToken {
+private:
+    std::shared_ptr<std::atomic<bool>> flag;
+
+public:
+    CancellationToken();
+    void cancel() noexcept;
+    bool isCancelled() const noexcept;
+};
+
+// Параметры длительных вычислений (задача о назначениях, паросочетания)
+// Срок и отмена проверяются на границах фаз: после каждого увеличивающего пути
+struct SolveOptions {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point deadline = Clock::time_point::max();
+    const CancellationToken* cancellation = nullptr;
+    // Вызывается после каждой фазы: сколько фаз выполнено из скольких
+    std::function<void(int done, int total)> progress;
+
+    static SolveOptions withTimeout(Clock::duration timeout);
+    bool shouldStop() const;
+    bool hasLimits() const;
+};
+
+// Итог вычисления с SolveOptions
+// При отмене или истечении срока complete == false, а результат - лучший найденный к этому моменту
+struct SolveStatus {
+    bool complete = true;
+    int phasesDone = 0;
+    int phasesTotal = 0;
+};
+
+#endif // SOLVEOPTIONS_H
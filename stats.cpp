@@ -0,0 +1,40 @@
+#include "stats.h"
+#include <ostream>
+#include <sstream>
+
+void AlgorithmStats::reset() {
+    *this = AlgorithmStats();
+}
+
+// Счётчики в формате JSON, одним объектом в одну строку
+std::string AlgorithmStats::toJson() const {
+    std::ostringstream os;
+    os << "{\"enabled\":" << (kStatsEnabled ? "true" : "false")
+       << ",\"bfsPhases\":" << bfsPhases
+       << ",\"augmentingPaths\":" << augmentingPaths
+       << ",\"blossomsContracted\":" << blossomsContracted
+       << ",\"dualUpdates\":" << dualUpdates
+       << ",\"edgesScanned\":" << edgesScanned
+       << ",\"allocations\":" << allocations
+       << ",\"adjacencyBuilds\":" << adjacencyBuilds
+       << ",\"simplexPivots\":" << simplexPivots
+       << ",\"seconds\":{"
+       << "\"adjacency\":" << adjacencySeconds
+       << ",\"bipartite\":" << bipartiteSeconds
+       << ",\"matching\":" << matchingSeconds
+       << ",\"bipartiteMatching\":" << bipartiteMatchingSeconds
+       << ",\"assignmentBuild\":" << assignmentBuildSeconds
+       << ",\"assignmentSolve\":" << assignmentSolveSeconds
+       << ",\"flowSolve\":" << flowSolveSeconds
+       << "}}";
+    return os.str();
+}
+
+AlgorithmStats& threadStats() noexcept {
+    thread_local AlgorithmStats stats;
+    return stats;
+}
+
+void writeStatsJson(std::ostream& os, const AlgorithmStats& stats) {
+    os << stats.toJson() << '\n';
+}
@@ -0,0 +1,74 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+// Счётчики работы алгоритмов графа
+// Собираются только при сборке с -DGRAPH_STATS; без флага макросы ниже
+// раскрываются в пустые выражения и не стоят ничего. Счётчики свои у каждого потока
+struct AlgorithmStats {
+    std::uint64_t bfsPhases = 0;           // запуски обхода в ширину (компоненты, поиски путей)
+    std::uint64_t augmentingPaths = 0;     // найденные увеличивающие пути
+    std::uint64_t blossomsContracted = 0;  // сжатые цветки в алгоритме Эдмондса
+    std::uint64_t dualUpdates = 0;         // изменения потенциалов в венгерском алгоритме
+    std::uint64_t edgesScanned = 0;        // просмотренные записи списков смежности
+    std::uint64_t allocations = 0;         // выделения памяти в рабочей области
+    std::uint64_t adjacencyBuilds = 0;     // перестроения списков смежности
+    std::uint64_t simplexPivots = 0;       // смены базиса в сетевом симплекс-методе
+
+    // Время этапов в секундах; вложенные этапы входят во внешние
+    double adjacencySeconds = 0.0;
+    double bipartiteSeconds = 0.0;
+    double matchingSeconds = 0.0;
+    double bipartiteMatchingSeconds = 0.0;
+    double assignmentBuildSeconds = 0.0;
+    double assignmentSolveSeconds = 0.0;
+    double flowSolveSeconds = 0.0;
+
+    void reset();
+    std::string toJson() const;
+};
+
+constexpr bool kStatsEnabled =
+#ifdef GRAPH_STATS
+    true;
+#else
+    false;
+#endif
+
+// Счётчики текущего потока
+AlgorithmStats& threadStats() noexcept;
+void writeStatsJson(std::ostream& os, const AlgorithmStats& stats);
+
+// Прибавляет к полю счётчика время жизни объекта
+class ScopedStatTimer {
+private:
+    double& target;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedStatTimer(double& target)
+        : target(target), start(std::chrono::steady_clock::now()) {}
+    ~ScopedStatTimer() {
+        target += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    ScopedStatTimer(const ScopedStatTimer&) = delete;
+    ScopedStatTimer& operator=(const ScopedStatTimer&) = delete;
+};
+
+#define GRAPH_STAT_CONCAT_IMPL(a, b) a##b
+#define GRAPH_STAT_CONCAT(a, b) GRAPH_STAT_CONCAT_IMPL(a, b)
+
+#ifdef GRAPH_STATS
+#define GRAPH_STAT_ADD(field, value) (threadStats().field += (value))
+#define GRAPH_STAT_TIMER(field) \
+    ScopedStatTimer GRAPH_STAT_CONCAT(statTimer, __LINE__)(threadStats().field)
+#else
+#define GRAPH_STAT_ADD(field, value) ((void)0)
+#define GRAPH_STAT_TIMER(field) ((void)0)
+#endif
+
+#endif // STATS_H
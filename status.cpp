@@ -0,0 +1,44 @@
+#include "status.h"
+
+// Текстовое описание кода ошибки
+const char* errorMessage(GraphError error) noexcept {
+    switch (error) {
+        case GraphError::None:
+            return "Нет ошибки";
+        case GraphError::NegativeVertexId:
+            return "ID вершины не может быть отрицательным";
+        case GraphError::EmptyLabel:
+            return "Метка вершины не может быть пустой";
+        case GraphError::NegativeSourceId:
+            return "ID вершины-источника не может быть отрицательным";
+        case GraphError::NegativeTargetId:
+            return "ID вершины-назначения не может быть отрицательным";
+        case GraphError::SelfLoop:
+            return "Самопетля недопустима";
+        case GraphError::NonPositiveWeight:
+            return "Вес ребра должен быть положительным числом";
+        case GraphError::InvalidDirectedFlag:
+            return "Флаг направленности должен быть 0 или 1";
+        case GraphError::DuplicateVertex:
+            return "Вершина уже существует";
+        case GraphError::VertexNotFound:
+            return "Вершина не найдена";
+        case GraphError::SourceNotFound:
+            return "Вершина-источник не найдена";
+        case GraphError::TargetNotFound:
+            return "Вершина-назначение не найдена";
+        case GraphError::DuplicateEdge:
+            return "Такое ребро уже существует";
+        case GraphError::EdgeNotFound:
+            return "Ребро не найдено";
+        case GraphError::ParseError:
+            return "Не удалось разобрать строку";
+        case GraphError::NonSquareMatrix:
+            return "Матрица смежности должна быть квадратной";
+        case GraphError::StreamError:
+            return "Ошибка ввода/вывода";
+        case GraphError::OutOfMemory:
+            return "Недостаточно памяти";
+    }
+    return "Неизвестная ошибка";
+}
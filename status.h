@@ -0,0 +1,52 @@
+#ifndef STATUS_H
+#define STATUS_H
+
+#include <utility>
+
+// Коды ошибок операций над графом
+// Используются API без исключений (tryAddVertex, findVertex, parse и т.д.)
+enum class GraphError {
+    None,
+    NegativeVertexId,
+    EmptyLabel,
+    NegativeSourceId,
+    NegativeTargetId,
+    SelfLoop,
+    NonPositiveWeight,
+    InvalidDirectedFlag,
+    DuplicateVertex,
+    VertexNotFound,
+    SourceNotFound,
+    TargetNotFound,
+    DuplicateEdge,
+    EdgeNotFound,
+    ParseError,
+    NonSquareMatrix,
+    StreamError,
+    OutOfMemory
+};
+
+const char* errorMessage(GraphError error) noexcept;
+
+// Результат операции: значение либо код ошибки (упрощённый аналог std::expected)
+template <typename T>
+class Expected {
+private:
+    T storedValue;
+    GraphError storedError;
+
+public:
+    Expected(const T& value) : storedValue(value), storedError(GraphError::None) {}
+    Expected(T&& value) : storedValue(std::move(value)), storedError(GraphError::None) {}
+    Expected(GraphError error) : storedValue(), storedError(error) {}
+
+    bool hasValue() const noexcept { return storedError == GraphError::None; }
+    explicit operator bool() const noexcept { return hasValue(); }
+    GraphError error() const noexcept { return storedError; }
+    const T& value() const noexcept { return storedValue; }
+    T& value() noexcept { return storedValue; }
+    const T* operator->() const noexcept { return &storedValue; }
+    T* operator->() noexcept { return &storedValue; }
+};
+
+#endif // STATUS_H
@@ -0,0 +1,338 @@
+#include "verifier.h"
+#include "graph.h"
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+namespace {
+
+const double kTolerance = 1e-9;
+
+Verification failure(const std::string& reason) {
+    Verification result;
+    result.valid = false;
+    result.reason = reason;
+    return result;
+}
+
+// Концы ребра e по плотным индексам
+void edgeEnds(const Graph& graph, int e, int& from, int& to) {
+    EdgeView edge = graph.edgeAt(e);
+    from = graph.indexOf(edge.getFromId());
+    to = graph.indexOf(edge.getToId());
+}
+
+std::string edgeName(int fromId, int toId) {
+    return std::to_string(fromId) + " - " + std::to_string(toId);
+}
+
+// Партнёры вершин паросочетания по плотным индексам (-1 у свободных вершин)
+Verification buildMates(const Graph& graph, const std::vector<std::pair<int, int>>& matching, std::vector<int>& mate) {
+    mate.assign(graph.getVertexCount(), -1);
+    for (const auto& pair : matching) {
+        int a = graph.indexOf(pair.first);
+        int b = graph.indexOf(pair.second);
+        if (a == -1 || b == -1) {
+            return failure("Вершина пары " + edgeName(pair.first, pair.second) + " отсутствует в графе");
+        }
+        if (a == b) {
+            return failure("Вершина " + std::to_string(pair.first) + " сопоставлена сама себе");
+        }
+        if (mate[a] != -1 || mate[b] != -1) {
+            return failure("Вершина пары " + edgeName(pair.first, pair.second) + " входит в паросочетание дважды");
+        }
+        mate[a] = b;
+        mate[b] = a;
+    }
+
+    // Каждая пара должна быть подтверждена хотя бы одним ребром графа
+    std::vector<unsigned char> confirmed(mate.size(), 0);
+    for (int e = 0; e < graph.getEdgeCount(); e++) {
+        int from, to;
+        edgeEnds(graph, e, from, to);
+        if (mate[from] == to) {
+            confirmed[from] = 1;
+            confirmed[to] = 1;
+        }
+    }
+    for (const auto& pair : matching) {
+        if (!confirmed[graph.indexOf(pair.first)]) {
+            return failure("Между вершинами пары " + edgeName(pair.first, pair.second) + " нет ребра");
+        }
+    }
+    return Verification();
+}
+
+}
+
+Verification verifyMatching(const Graph& graph, const std::vector<std::pair<int, int>>& matching) {
+    std::vector<int> mate;
+    return buildMates(graph, matching, mate);
+}
+
+Verification verifyMaximumBipartiteMatching(const Graph& graph,
+                                            const std::vector<std::pair<int, int>>& matching,
+                                            const std::vector<int>& vertexCover) {
+    Verification result = verifyMatching(graph, matching);
+    if (!result) {
+        return result;
+    }
+
+    // Любое покрытие не меньше любого паросочетания, поэтому равенство размеров
+    // доказывает максимальность и без проверки двудольности
+    std::vector<unsigned char> inCover(graph.getVertexCount(), 0);
+    for (int id : vertexCover) {
+        int index = graph.indexOf(id);
+        if (index == -1) {
+            return failure("Вершина покрытия " + std::to_string(id) + " отсутствует в графе");
+        }
+        if (inCover[index]) {
+            return failure("Вершина " + std::to_string(id) + " входит в покрытие дважды");
+        }
+        inCover[index] = 1;
+    }
+    for (int e = 0; e < graph.getEdgeCount(); e++) {
+        int from, to;
+        edgeEnds(graph, e, from, to);
+        if (!inCover[from] && !inCover[to]) {
+            return failure("Ребро " + edgeName(graph.idAt(from), graph.idAt(to)) + " не покрыто");
+        }
+    }
+    if (vertexCover.size() != matching.size()) {
+        return failure("Размер покрытия " + std::to_string(vertexCover.size()) +
+                       " не равен размеру паросочетания " + std::to_string(matching.size()));
+    }
+    return Verification();
+}
+
+Verification verifyMaximumMatching(const Graph& graph,
+                                   const std::vector<std::pair<int, int>>& matching,
+                                   const GallaiEdmonds& certificate) {
+    Verification result = verifyMatching(graph, matching);
+    if (!result) {
+        return result;
+    }
+
+    int n = graph.getVertexCount();
+    std::vector<unsigned char> inCover(n, 0);
+    std::vector<int> oddSet(n, -1);
+    std::size_t dual = 0;
+
+    for (int v : certificate.coverVertices) {
+        if (v < 0 || v >= n || inCover[v]) {
+            return failure("Некорректная или повторная вершина покрытия с индексом " + std::to_string(v));
+        }
+        inCover[v] = 1;
+        dual++;
+    }
+
+    const std::vector<int>& offsets = certificate.oddSetOffsets;
+    if (!offsets.empty() && (offsets.front() != 0 ||
+                             offsets.back() != static_cast<int>(certificate.oddSetVertices.size()))) {
+        return failure("Границы нечётных множеств не согласованы со списком их вершин");
+    }
+    for (std::size_t s = 0; s + 1 < offsets.size(); s++) {
+        int size = offsets[s + 1] - offsets[s];
+        if (size <= 0 || size % 2 == 0) {
+            return failure("Множество " + std::to_string(s) + " сертификата не нечётное");
+        }
+        for (int k = offsets[s]; k < offsets[s + 1]; k++) {
+            int v = certificate.oddSetVertices[k];
+            if (v < 0 || v >= n || inCover[v] || oddSet[v] != -1) {
+                return failure("Множества сертификата пересекаются по вершине с индексом " + std::to_string(v));
+            }
+            oddSet[v] = s;
+        }
+        dual += (size - 1) / 2;
+    }
+
+    for (int e = 0; e < graph.getEdgeCount(); e++) {
+        int from, to;
+        edgeEnds(graph, e, from, to);
+        if (!inCover[from] && !inCover[to] && (oddSet[from] == -1 || oddSet[from] != oddSet[to])) {
+            return failure("Ребро " + edgeName(graph.idAt(from), graph.idAt(to)) + " не покрыто сертификатом");
+        }
+    }
+    if (dual != matching.size()) {
+        return failure("Двойственная оценка " + std::to_string(dual) +
+                       " не равна размеру паросочетания " + std::to_string(matching.size()));
+    }
+    return Verification();
+}
+
+Verification verifyAssignment(const Graph& graph,
+                              const std::vector<int>& firstPart,
+                              const std::vector<int>& secondPart,
+                              const std::vector<std::pair<int, int>>& matching,
+                              double cost,
+                              const std::vector<double>& workerPotentials,
+                              const std::vector<double>& taskPotentials) {
+    int n = firstPart.size();
+    if (static_cast<int>(secondPart.size()) != n) {
+        return failure("Размеры долей различны");
+    }
+    if (static_cast<int>(workerPotentials.size()) != n || static_cast<int>(taskPotentials.size()) != n) {
+        return failure("Число потенциалов не совпадает с размером долей");
+    }
+    if (static_cast<int>(matching.size()) != n) {
+        return failure("Назначение не совершенное: " + std::to_string(matching.size()) +
+                       " пар из " + std::to_string(n));
+    }
+
+    // Позиции вершин в долях по плотным индексам
+    int vertexCount = graph.getVertexCount();
+    std::vector<int> row(vertexCount, -1);
+    std::vector<int> column(vertexCount, -1);
+    for (int i = 0; i < n; i++) {
+        int index = graph.indexOf(firstPart[i]);
+        if (index != -1) {
+            if (row[index] != -1) {
+                return failure("Вершина " + std::to_string(firstPart[i]) + " повторяется в первой доле");
+            }
+            row[index] = i;
+        }
+        index = graph.indexOf(secondPart[i]);
+        if (index != -1) {
+            if (column[index] != -1) {
+                return failure("Вершина " + std::to_string(secondPart[i]) + " повторяется во второй доле");
+            }
+            column[index] = i;
+        }
+    }
+
+    std::vector<int> assigned(n, -1);
+    std::vector<unsigned char> taskUsed(n, 0);
+    for (const auto& pair : matching) {
+        int worker = graph.indexOf(pair.first);
+        int task = graph.indexOf(pair.second);
+        int i = worker == -1 ? -1 : row[worker];
+        int j = task == -1 ? -1 : column[task];
+        if (i == -1 || j == -1) {
+            return failure("Пара " + edgeName(pair.first, pair.second) + " не соединяет первую долю со второй");
+        }
+        if (assigned[i] != -1 || taskUsed[j]) {
+            return failure("Вершина пары " + edgeName(pair.first, pair.second) + " назначена дважды");
+        }
+        assigned[i] = j;
+        taskUsed[j] = 1;
+    }
+
+    // Пары в порядке рёбер: вес пары задаёт первое ребро, остальные кратные пропускаются
+    std::unordered_set<std::uint64_t> seen;
+    seen.reserve(graph.getEdgeCount());
+    std::vector<double> assignedWeight(n, 0.0);
+    std::vector<unsigned char> assignedFound(n, 0);
+    Verification result;
+
+    auto visit = [&](int from, int to, double weight) {
+        int i = row[from];
+        int j = column[to];
+        if (i == -1 || j == -1 || !seen.insert(static_cast<std::uint64_t>(i) * n + j).second) {
+            return;
+        }
+        double reduced = weight - workerPotentials[i] - taskPotentials[j];
+        double tolerance = kTolerance * (1.0 + std::fabs(weight) + std::fabs(workerPotentials[i]) +
+                                         std::fabs(taskPotentials[j]));
+        if (reduced < -tolerance) {
+            result = failure("Потенциалы недопустимы на паре " + edgeName(firstPart[i], secondPart[j]) +
+                             ": приведённая стоимость " + std::to_string(reduced));
+        } else if (assigned[i] == j) {
+            if (reduced > tolerance) {
+                result = failure("Нарушена дополняющая нежёсткость на паре " + edgeName(firstPart[i], secondPart[j]) +
+                                 ": приведённая стоимость " + std::to_string(reduced));
+            }
+            assignedWeight[i] = weight;
+            assignedFound[i] = 1;
+        }
+    };
+
+    for (int e = 0; e < graph.getEdgeCount() && result; e++) {
+        EdgeView edge = graph.edgeAt(e);
+        int from = graph.indexOf(edge.getFromId());
+        int to = graph.indexOf(edge.getToId());
+        visit(from, to, edge.getWeight());
+        if (!edge.getIsDirected() && result) {
+            visit(to, from, edge.getWeight());
+        }
+    }
+    if (!result) {
+        return result;
+    }
+
+    double total = 0.0;
+    double scale = 1.0;
+    for (int i = 0; i < n; i++) {
+        if (!assignedFound[i]) {
+            return failure("Между вершинами пары " + edgeName(firstPart[i], secondPart[assigned[i]]) + " нет ребра");
+        }
+        total += assignedWeight[i];
+        scale += std::fabs(assignedWeight[i]);
+    }
+    if (std::fabs(total - cost) > kTolerance * scale) {
+        return failure("Стоимость " + std::to_string(cost) + " не равна весу назначения " + std::to_string(total));
+    }
+    return Verification();
+}
+
+Verification verifyBipartition(const Graph& graph, const std::vector<int>& partition) {
+    if (static_cast<int>(partition.size()) != graph.getVertexCount()) {
+        return failure("Размер разбиения не равен числу вершин");
+    }
+    for (int v = 0; v < graph.getVertexCount(); v++) {
+        if (partition[v] != 0 && partition[v] != 1) {
+            return failure("Вершина " + std::to_string(graph.idAt(v)) + " не отнесена ни к одной доле");
+        }
+    }
+    for (int e = 0; e < graph.getEdgeCount(); e++) {
+        int from, to;
+        edgeEnds(graph, e, from, to);
+        if (partition[from] == partition[to]) {
+            return failure("Ребро " + edgeName(graph.idAt(from), graph.idAt(to)) + " соединяет вершины одной доли");
+        }
+    }
+    return Verification();
+}
+
+Verification verifyOddCycle(const Graph& graph, const std::vector<int>& cycle) {
+    int length = cycle.size();
+    if (length < 3 || length % 2 == 0) {
+        return failure("Длина цикла " + std::to_string(length) + " не нечётная или меньше 3");
+    }
+
+    std::vector<int> position(graph.getVertexCount(), -1);
+    for (int k = 0; k < length; k++) {
+        int index = graph.indexOf(cycle[k]);
+        if (index == -1) {
+            return failure("Вершина цикла " + std::to_string(cycle[k]) + " отсутствует в графе");
+        }
+        if (position[index] != -1) {
+            return failure("Вершина " + std::to_string(cycle[k]) + " повторяется в цикле");
+        }
+        position[index] = k;
+    }
+
+    // Отрезок k - ребро между cycle[k] и cycle[k + 1] (последний замыкает цикл)
+    std::vector<unsigned char> segment(length, 0);
+    for (int e = 0; e < graph.getEdgeCount(); e++) {
+        int from, to;
+        edgeEnds(graph, e, from, to);
+        int a = position[from];
+        int b = position[to];
+        if (a == -1 || b == -1) {
+            continue;
+        }
+        if ((a + 1) % length == b) {
+            segment[a] = 1;
+        }
+        if ((b + 1) % length == a) {
+            segment[b] = 1;
+        }
+    }
+    for (int k = 0; k < length; k++) {
+        if (!segment[k]) {
+            return failure("Между вершинами цикла " + edgeName(cycle[k], cycle[(k + 1) % length]) + " нет ребра");
+        }
+    }
+    return Verification();
+}
@@ -0,0 +1,57 @@
+#ifndef VERIFIER_H
+#define VERIFIER_H
+
+#include "gallaiedmonds.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+class Graph;
+
+// Проверка результатов алгоритмов по сертификатам за O(V + E)
+// Проверки не доверяют решателю: они заново просматривают все рёбра графа и поэтому
+// дешевле самих алгоритмов, их можно оставлять включёнными в рабочей сборке.
+// Направления рёбер не учитываются, как в алгоритмах паросочетаний
+struct Verification {
+    bool valid = true;
+    std::string reason;     // пусто, если результат подтверждён
+
+    explicit operator bool() const noexcept { return valid; }
+};
+
+// Паросочетание (пары ID) корректно: каждая пара соединена ребром, вершины не повторяются
+Verification verifyMatching(const Graph& graph, const std::vector<std::pair<int, int>>& matching);
+
+// Паросочетание двудольного графа максимально: vertexCover (ID) покрывает все рёбра
+// и его размер равен размеру паросочетания (теорема Кёнига)
+Verification verifyMaximumBipartiteMatching(const Graph& graph,
+                                            const std::vector<std::pair<int, int>>& matching,
+                                            const std::vector<int>& vertexCover);
+
+// Паросочетание произвольного графа максимально: вершины покрытия и нечётные множества
+// сертификата покрывают все рёбра, а их двойственная стоимость равна размеру
+// паросочетания (формула Татта-Бержа). Стоимость пересчитывается, dualValue не используется
+Verification verifyMaximumMatching(const Graph& graph,
+                                   const std::vector<std::pair<int, int>>& matching,
+                                   const GallaiEdmonds& certificate);
+
+// Назначение оптимально: потенциалы допустимы (w - u[i] - v[j] >= 0 для каждой пары),
+// на парах назначения выполнена дополняющая нежёсткость, и cost равна его весу.
+// Пары и веса - как в solveAssignmentProblem (первое исходящее ребро работника в задачу);
+// ID в долях должны быть различны. Сравнения - с относительной погрешностью 1e-9
+Verification verifyAssignment(const Graph& graph,
+                              const std::vector<int>& firstPart,
+                              const std::vector<int>& secondPart,
+                              const std::vector<std::pair<int, int>>& matching,
+                              double cost,
+                              const std::vector<double>& workerPotentials,
+                              const std::vector<double>& taskPotentials);
+
+// Двудольность: partition (по плотным индексам, 0 или 1) - правильная 2-раскраска
+Verification verifyBipartition(const Graph& graph, const std::vector<int>& partition);
+
+// Недвудольность: cycle (ID) - простой цикл нечётной длины, каждая пара соседних вершин
+// и последняя с первой соединены ребром
+Verification verifyOddCycle(const Graph& graph, const std::vector<int>& cycle);
+
+#endif // VERIFIER_H
@@ -1,5 +1,8 @@
 #include "vertex.h"
+#include "logsink.h"
+#include "parsing.h"
 #include <stdexcept>
+#include <new>
 
 // Конструктор по умолчанию
 // Инициализирует вершину с нулевыми значениями
@@ -10,15 +13,58 @@ Vertex::Vertex() : id(0), label(""), weight(0.0) {}
 Vertex::Vertex(int id, const std::string& label, double weight)
     : id(id), label(label), weight(weight) {
 
-    // Проверка на отрицательный ID - ID должен быть неотрицательным
-    if (id < 0) {
-        throw std::invalid_argument("ID вершины не может быть отрицательным");
+    GraphError error = validate(id, label);
+    if (error != GraphError::None) {
+        throw std::invalid_argument(errorMessage(error));
     }
+}
 
-    // Проверка на пустую метку - каждая вершина должна иметь описание
+// Проверка параметров вершины без исключений
+// ID должен быть неотрицательным, а метка - непустой
+GraphError Vertex::validate(int id, std::string_view label) noexcept {
+    if (id < 0) {
+        return GraphError::NegativeVertexId;
+    }
     if (label.empty()) {
-        throw std::invalid_argument("Метка вершины не может быть пустой");
+        return GraphError::EmptyLabel;
+    }
+    return GraphError::None;
+}
+
+// Разбор вершины из строки формата "1 NodeA 5.5" без исключений
+// При ошибке vertex не изменяется
+GraphError Vertex::parse(std::string_view text, Vertex& vertex) noexcept {
+    std::string_view token;
+    int tempId;
+    std::string_view tempLabel;
+    double tempWeight;
+
+    if (!nextToken(text, token) || !parseInt(token, tempId)) {
+        return GraphError::ParseError;
+    }
+    if (!nextToken(text, tempLabel)) {
+        return GraphError::ParseError;
+    }
+    if (!nextToken(text, token) || !parseDouble(token, tempWeight)) {
+        return GraphError::ParseError;
+    }
+    if (nextToken(text, token)) {
+        return GraphError::ParseError;
+    }
+
+    GraphError error = validate(tempId, tempLabel);
+    if (error != GraphError::None) {
+        return error;
+    }
+
+    try {
+        vertex.label.assign(tempLabel.data(), tempLabel.size());
+    } catch (const std::bad_alloc&) {
+        return GraphError::OutOfMemory;
     }
+    vertex.id = tempId;
+    vertex.weight = tempWeight;
+    return GraphError::None;
 }
 
 // Геттер для ID
@@ -27,7 +73,8 @@ int Vertex::getId() const {
 }
 
 // Геттер для метки
-std::string Vertex::getLabel() const {
+// Возвращает представление без копирования строки
+std::string_view Vertex::getLabel() const {
     return label;
 }
 
@@ -39,7 +86,7 @@ double Vertex::getWeight() const {
 // Сеттер для ID с валидацией
 void Vertex::setId(int newId) {
     if (newId < 0) {
-        throw std::invalid_argument("ID вершины не может быть отрицательным");
+        throw std::invalid_argument(errorMessage(GraphError::NegativeVertexId));
     }
     id = newId;
 }
@@ -47,7 +94,7 @@ void Vertex::setId(int newId) {
 // Сеттер для метки с валидацией
 void Vertex::setLabel(const std::string& newLabel) {
     if (newLabel.empty()) {
-        throw std::invalid_argument("Метка вершины не может быть пустой");
+        throw std::invalid_argument(errorMessage(GraphError::EmptyLabel));
     }
     label = newLabel;
 }
@@ -75,7 +122,7 @@ std::ostream& operator<<(std::ostream& os, const Vertex& vertex) {
         return os;
     } catch (const std::ios_base::failure& e) {
         // Обрабатываем ошибки потока
-        std::cerr << "Ошибка ввода/вывода: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка ввода/вывода: ") + e.what());
         throw;
     }
 }
@@ -122,12 +169,12 @@ std::istream& operator>>(std::istream& is, Vertex& vertex) {
 
     } catch (const std::invalid_argument& e) {
         // Обрабатываем ошибки валидации данных
-        std::cerr << "Ошибка при вводе вершины: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Ошибка при вводе вершины: ") + e.what());
         is.setstate(std::ios_base::failbit);  // Устанавливаем флаг ошибки потока
         throw;
     } catch (const std::exception& e) {
         // Обрабатываем прочие исключения
-        std::cerr << "Неожиданная ошибка при вводе вершины: " << e.what() << std::endl;
+        logMessage(LogLevel::Error, std::string("Неожиданная ошибка при вводе вершины: ") + e.what());
         is.setstate(std::ios_base::failbit);
         throw;
     }
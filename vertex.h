@@ -3,7 +3,9 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <stdexcept>
+#include "status.h"
 
 class Vertex {
 private:
@@ -14,8 +16,10 @@ private:
 public:
     Vertex();
     Vertex(int id, const std::string& label, double weight = 0.0);
+    static GraphError validate(int id, std::string_view label) noexcept;
+    static GraphError parse(std::string_view text, Vertex& vertex) noexcept;
     int getId() const;
-    std::string getLabel() const;
+    std::string_view getLabel() const;
     double getWeight() const;
     void setId(int id);
     void setLabel(const std::string& label);
@@ -0,0 +1,127 @@
+#include "workspace.h"
+#include "stats.h"
+#include <limits>
+
+AlgorithmWorkspace::AlgorithmWorkspace()
+    : intBuffers(), doubleBuffers(), longBuffers(), wordBuffers(), marks(), allocationCount(0) {}
+
+// Буфер в текущем состоянии, без изменения размера и содержимого
+std::vector<int>& AlgorithmWorkspace::ints(IntBuffer buffer) {
+    return intBuffers[buffer];
+}
+
+// Буфер нужного размера, заполненный значением fill
+// Выделение памяти происходит только если ёмкости буфера не хватает
+std::vector<int>& AlgorithmWorkspace::ints(IntBuffer buffer, std::size_t size, int fill) {
+    std::vector<int>& result = intBuffers[buffer];
+    if (result.capacity() < size) {
+        allocationCount++;
+        GRAPH_STAT_ADD(allocations, 1);
+    }
+    result.assign(size, fill);
+    return result;
+}
+
+// Пустой буфер с запасом ёмкости, используется как очередь или стек
+std::vector<int>& AlgorithmWorkspace::cleared(IntBuffer buffer, std::size_t reserve) {
+    std::vector<int>& result = intBuffers[buffer];
+    result.clear();
+    if (result.capacity() < reserve) {
+        allocationCount++;
+        GRAPH_STAT_ADD(allocations, 1);
+        result.reserve(reserve);
+    }
+    return result;
+}
+
+std::vector<double>& AlgorithmWorkspace::doubles(DoubleBuffer buffer) {
+    return doubleBuffers[buffer];
+}
+
+std::vector<double>& AlgorithmWorkspace::doubles(DoubleBuffer buffer, std::size_t size, double fill) {
+    std::vector<double>& result = doubleBuffers[buffer];
+    if (result.capacity() < size) {
+        allocationCount++;
+        GRAPH_STAT_ADD(allocations, 1);
+    }
+    result.assign(size, fill);
+    return result;
+}
+
+std::vector<std::int64_t>& AlgorithmWorkspace::longs(LongBuffer buffer) {
+    return longBuffers[buffer];
+}
+
+std::vector<std::int64_t>& AlgorithmWorkspace::longs(LongBuffer buffer, std::size_t size, std::int64_t fill) {
+    std::vector<std::int64_t>& result = longBuffers[buffer];
+    if (result.capacity() < size) {
+        allocationCount++;
+        GRAPH_STAT_ADD(allocations, 1);
+    }
+    result.assign(size, fill);
+    return result;
+}
+
+std::vector<std::uint64_t>& AlgorithmWorkspace::words(WordBuffer buffer) {
+    return wordBuffers[buffer];
+}
+
+std::vector<std::uint64_t>& AlgorithmWorkspace::words(WordBuffer buffer, std::size_t size, std::uint64_t fill) {
+    std::vector<std::uint64_t>& result = wordBuffers[buffer];
+    if (result.capacity() < size) {
+        allocationCount++;
+        GRAPH_STAT_ADD(allocations, 1);
+    }
+    result.assign(size, fill);
+    return result;
+}
+
+// Новая метка посещения для буфера
+// Вершина считается посещённой, если buffer[v] равен текущей метке,
+// поэтому сбрасывать буфер между поисками не нужно
+int AlgorithmWorkspace::nextMark(IntBuffer buffer, std::size_t size) {
+    std::vector<int>& marked = intBuffers[buffer];
+    if (marked.size() != size || marks[buffer] == std::numeric_limits<int>::max()) {
+        ints(buffer, size, 0);
+        marks[buffer] = 0;
+    }
+    return ++marks[buffer];
+}
+
+std::size_t AlgorithmWorkspace::getAllocationCount() const {
+    return allocationCount;
+}
+
+std::size_t AlgorithmWorkspace::getReservedBytes() const {
+    std::size_t bytes = 0;
+    for (const auto& buffer : intBuffers) {
+        bytes += buffer.capacity() * sizeof(int);
+    }
+    for (const auto& buffer : doubleBuffers) {
+        bytes += buffer.capacity() * sizeof(double);
+    }
+    for (const auto& buffer : longBuffers) {
+        bytes += buffer.capacity() * sizeof(std::int64_t);
+    }
+    for (const auto& buffer : wordBuffers) {
+        bytes += buffer.capacity() * sizeof(std::uint64_t);
+    }
+    return bytes;
+}
+
+// Освобождение всей памяти рабочей области
+void AlgorithmWorkspace::release() {
+    for (auto& buffer : intBuffers) {
+        std::vector<int>().swap(buffer);
+    }
+    for (auto& buffer : doubleBuffers) {
+        std::vector<double>().swap(buffer);
+    }
+    for (auto& buffer : longBuffers) {
+        std::vector<std::int64_t>().swap(buffer);
+    }
+    for (auto& buffer : wordBuffers) {
+        std::vector<std::uint64_t>().swap(buffer);
+    }
+    marks.fill(0);
+}
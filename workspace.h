@@ -0,0 +1,81 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Рабочая область алгоритмов графа
+// Хранит временные буферы между вызовами: при повторных запросах к графу
+// того же размера память повторно не выделяется
+class AlgorithmWorkspace {
+public:
+    enum IntBuffer {
+        Match,
+        Parent,
+        Base,
+        Color,
+        Blossom,
+        Queue,
+        Mark,
+        Partition,
+        Used,
+        Way,
+        Assignment,
+        ColumnHead,
+        ColumnNext,
+        Stack,
+        IntBufferCount
+    };
+
+    enum DoubleBuffer {
+        Cost,
+        PotentialU,
+        PotentialV,
+        MinDelta,
+        DoubleBufferCount
+    };
+
+    // Буферы целочисленного режима задачи о назначениях
+    enum LongBuffer {
+        IntegerCost,
+        IntegerPotentialU,
+        IntegerPotentialV,
+        IntegerMinDelta,
+        LongBufferCount
+    };
+
+    // Битовые строки по 64 вершины в слове
+    enum WordBuffer {
+        AdjacencyBits,
+        VisitedBits,
+        FreeBits,
+        WordBufferCount
+    };
+
+    AlgorithmWorkspace();
+    std::vector<int>& ints(IntBuffer buffer);
+    std::vector<int>& ints(IntBuffer buffer, std::size_t size, int fill);
+    std::vector<int>& cleared(IntBuffer buffer, std::size_t reserve);
+    std::vector<double>& doubles(DoubleBuffer buffer);
+    std::vector<double>& doubles(DoubleBuffer buffer, std::size_t size, double fill);
+    std::vector<std::int64_t>& longs(LongBuffer buffer);
+    std::vector<std::int64_t>& longs(LongBuffer buffer, std::size_t size, std::int64_t fill);
+    std::vector<std::uint64_t>& words(WordBuffer buffer);
+    std::vector<std::uint64_t>& words(WordBuffer buffer, std::size_t size, std::uint64_t fill);
+    int nextMark(IntBuffer buffer, std::size_t size);
+    std::size_t getAllocationCount() const;
+    std::size_t getReservedBytes() const;
+    void release();
+
+private:
+    std::array<std::vector<int>, IntBufferCount> intBuffers;
+    std::array<std::vector<double>, DoubleBufferCount> doubleBuffers;
+    std::array<std::vector<std::int64_t>, LongBufferCount> longBuffers;
+    std::array<std::vector<std::uint64_t>, WordBufferCount> wordBuffers;
+    std::array<int, IntBufferCount> marks;
+    std::size_t allocationCount;
+};
+
+#endif // WORKSPACE_H